@@ -1,7 +1,7 @@
 #include "shell.h"
 
 /* Determine if shell is operating in interactive mode. */
-int is_interactive_mode(info_t *info)
+int interactive(info_t *info)
 {
     return (isatty(STDIN_FILENO) && info->readfd <= 2) ? 1 : 0;
 }
@@ -29,10 +29,10 @@ int str_to_int(const char *str)
 {
     int result = 0, sign = 1, i = 0;
 
-    while (str[i] == ' ')  // Skip leading spaces
+    while (str[i] == ' ')  /* Skip leading spaces */
         i++;
 
-    if (str[i] == '-')  // Handle negative numbers
+    if (str[i] == '-')  /* Handle negative numbers */
     {
         sign = -1;
         i++;
@@ -0,0 +1,145 @@
+#include "shell.h"
+
+/**
+ * alias_find - looks up an alias by name
+ * @info: the parameter struct
+ * @name: the name
+ *
+ * Return: the alias, or NULL if there is none by that name
+ */
+alias_t *alias_find(info_t *info, char *name)
+{
+	alias_t *a;
+
+	if (!info->alias)
+		return (NULL);
+	for (a = info->alias[hash_key(name)]; a; a = a->next)
+		if (!_strcmp(a->name, name))
+			return (a);
+	return (NULL);
+}
+
+/**
+ * alias_word - measures a word of the value of an alias: up to the next
+ * blank outside quotes, as lex_scan() finds them; operators in it are no
+ * operators, the words being spliced into a command, see alias_expand();
+ * a quote left open runs to the end of the value, as exp_text() reads it
+ * @p: the start of the word
+ *
+ * Return: its length
+ */
+size_t alias_word(char *p)
+{
+	size_t n = 0;
+	char quote = 0;
+	int cont;
+
+	while (1)
+	{
+		n += lex_scan(p + n, &quote, &cont);
+		if (!p[n] || char_class[(unsigned char)p[n]] & CC_BLANK)
+			return (n);
+		n++;
+	}
+}
+
+/**
+ * alias_split - splits the value of an alias into words, once to count
+ * them and once to end each with a NUL; they are kept as written, to be
+ * expanded with the rest of the command
+ * @a: the alias, with text a copy of its value
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int alias_split(alias_t *a)
+{
+	char *p;
+	size_t n;
+	int fill;
+
+	for (fill = 0; fill < 2; fill++)
+	{
+		a->words = NULL;
+		if (fill)
+			a->words = malloc(sizeof(char *) * (a->nwords + 1));
+		if (fill && !a->words)
+			return (1);
+		for (p = a->text, a->nwords = 0; ; a->nwords++)
+		{
+			while (char_class[(unsigned char)*p] & CC_BLANK)
+				p++;
+			if (!*p)
+				break;
+			n = alias_word(p);
+			if (fill)
+				a->words[a->nwords] = p;
+			p += n;
+			if (*p && fill)
+				*p++ = '\0';
+		}
+	}
+	a->words[a->nwords] = NULL;
+	return (0);
+}
+
+/**
+ * alias_set - defines an alias, in place of any alias by the same name
+ * @info: the parameter struct
+ * @name: the name
+ * @value: the value
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int alias_set(info_t *info, char *name, char *value)
+{
+	alias_t *a;
+	unsigned int k;
+
+	if (!info->alias)
+	{
+		info->alias = malloc(sizeof(alias_t *) * CMD_HASH_SIZE);
+		if (!info->alias)
+			return (1);
+		_memset((void *)info->alias, 0,
+				sizeof(alias_t *) * CMD_HASH_SIZE);
+	}
+	a = malloc(sizeof(alias_t));
+	if (!a)
+		return (1);
+	_memset((void *)a, 0, sizeof(alias_t));
+	a->name = _strdup(name);
+	a->value = _strdup(value);
+	a->text = _strdup(value);
+	if (!a->name || !a->value || !a->text || alias_split(a))
+		return (alias_destroy(a), 1);
+	alias_unset(info, name);
+	k = hash_key(name);
+	a->next = info->alias[k];
+	info->alias[k] = a;
+	return (0);
+}
+
+/**
+ * alias_unset - removes an alias
+ * @info: the parameter struct
+ * @name: its name
+ *
+ * Return: 0 if it was removed, 1 if there was none by that name
+ */
+int alias_unset(info_t *info, char *name)
+{
+	alias_t **link, *a;
+
+	if (!info->alias)
+		return (1);
+	for (link = info->alias + hash_key(name); *link; link = &(a->next))
+	{
+		a = *link;
+		if (_strcmp(a->name, name))
+			continue;
+		*link = a->next;
+		alias_destroy(a);
+		return (0);
+	}
+	return (1);
+}
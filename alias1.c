@@ -0,0 +1,117 @@
+#include "shell.h"
+
+/**
+ * alias_expand - replaces the alias a command starts with by the words of
+ * its value, then the alias those start with, and so on, one lookup a
+ * level; each alias is marked while the expansion goes through it, so it
+ * is not expanded again within itself, as with alias ls='ls -F', nor in
+ * a cycle of aliases
+ * @info: the parameter struct
+ * @words: the words of the command, as written
+ * @n: the number of words; receives the number after expansion
+ *
+ * Return: the words, in the arena, or words itself if the command starts
+ *         with no alias; NULL on malloc failure
+ */
+char **alias_expand(info_t *info, char **words, int *n)
+{
+	alias_t *a = alias_find(info, words[0]), *last = NULL;
+	int total = *n, k = 0, i;
+	char **argv;
+
+	while (a && !a->active)
+	{
+		a->active = 1;
+		a->outer = last;
+		last = a;
+		total += a->nwords - 1;
+		a = a->nwords ? alias_find(info, a->words[0]) : NULL;
+	}
+	if (!last)
+		return (words);
+	argv = arena_alloc(&(info->arena), sizeof(char *) * (total + 1));
+	for (a = last, i = 0; a; a = a->outer, i = 1)
+	{
+		a->active = 0;
+		while (argv && i < a->nwords)
+			argv[k++] = a->words[i++];
+	}
+	for (i = 1; argv && i < *n; i++)
+		argv[k++] = words[i];
+	if (argv)
+		argv[k] = NULL;
+	*n = total;
+	return (argv);
+}
+
+/**
+ * alias_cmp - orders aliases by name, for qsort()
+ * @a: a pointer to an alias
+ * @b: a pointer to another
+ *
+ * Return: less than, equal to or more than 0 as the first name sorts
+ *         before, with or after the second
+ */
+int alias_cmp(const void *a, const void *b)
+{
+	return (_strcmp((*(alias_t * const *)a)->name,
+				(*(alias_t * const *)b)->name));
+}
+
+/**
+ * alias_list - prints the aliases, sorted by name
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int alias_list(info_t *info)
+{
+	alias_t *a, **sorted;
+	size_t n = 0, i;
+
+	for (i = 0; info->alias && i < CMD_HASH_SIZE; i++)
+		for (a = info->alias[i]; a; a = a->next)
+			n++;
+	sorted = malloc(sizeof(alias_t *) * (n + 1));
+	if (!sorted)
+		return (1);
+	for (n = 0, i = 0; info->alias && i < CMD_HASH_SIZE; i++)
+		for (a = info->alias[i]; a; a = a->next)
+			sorted[n++] = a;
+	qsort(sorted, n, sizeof(alias_t *), alias_cmp);
+	for (i = 0; i < n; i++)
+		show_alias(sorted[i]);
+	free(sorted);
+	return (0);
+}
+
+/**
+ * alias_free - frees every alias
+ * @info: the parameter struct
+ */
+void alias_free(info_t *info)
+{
+	alias_t *a, *next;
+	int i;
+
+	for (i = 0; info->alias && i < CMD_HASH_SIZE; i++)
+		for (a = info->alias[i]; a; a = next)
+		{
+			next = a->next;
+			alias_destroy(a);
+		}
+	bfree((void **)&info->alias);
+}
+
+/**
+ * alias_destroy - frees an alias
+ * @a: the alias
+ */
+void alias_destroy(alias_t *a)
+{
+	free(a->name);
+	free(a->value);
+	free(a->text);
+	free(a->words);
+	free(a);
+}
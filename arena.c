@@ -0,0 +1,92 @@
+#include "shell.h"
+
+/**
+ * arena_alloc - allocates from an arena by bumping an offset, moving on
+ * to the next block, or adding one, when the current block is full
+ * @a: the arena
+ * @size: the number of bytes
+ *
+ * Return: ARENA_ALIGN-aligned memory, valid until the arena is released
+ *         below it, or NULL on malloc failure
+ */
+void *arena_alloc(arena_t *a, size_t size)
+{
+	chunk_t *next;
+	void *p;
+
+	size = ARENA_ROUND(size);
+	while (!a->cur || a->used + size > a->cur->size)
+	{
+		next = a->cur ? a->cur->next : a->head;
+		if (!next)
+		{
+			next = malloc(ARENA_ROUND(sizeof(chunk_t)) +
+					(size > ARENA_CHUNK ? size : ARENA_CHUNK));
+			if (!next)
+				return (NULL);
+			next->next = NULL;
+			next->size = size > ARENA_CHUNK ? size : ARENA_CHUNK;
+			if (a->cur)
+				a->cur->next = next;
+			else
+				a->head = next;
+		}
+		a->cur = next;
+		a->used = 0;
+	}
+	p = CHUNK_DATA(a->cur) + a->used;
+	a->used += size;
+	return (p);
+}
+
+/**
+ * arena_grow - resizes the last allocation in place when it has room,
+ * copying it to a new allocation otherwise
+ * @a: the arena
+ * @ptr: the allocation, or NULL
+ * @old_size: the size it was allocated with
+ * @new_size: the size wanted
+ *
+ * Return: the allocation, or NULL on malloc failure
+ */
+void *arena_grow(arena_t *a, void *ptr, size_t old_size, size_t new_size)
+{
+	char *data;
+	size_t offset;
+	void *grown;
+
+	if (!ptr)
+		return (arena_alloc(a, new_size));
+	data = CHUNK_DATA(a->cur);
+	offset = (char *)ptr - data;
+	if ((char *)ptr >= data && (char *)ptr < data + a->used &&
+			offset + ARENA_ROUND(old_size) == a->used &&
+			offset + ARENA_ROUND(new_size) <= a->cur->size)
+	{
+		a->used = offset + ARENA_ROUND(new_size);
+		return (ptr);
+	}
+	grown = arena_alloc(a, new_size);
+	if (grown)
+		memcpy(grown, ptr, old_size < new_size ? old_size : new_size);
+	return (grown);
+}
+
+/**
+ * arena_copy - copies the first bytes of a string into an arena
+ * @a: the arena
+ * @s: the string
+ * @n: the number of bytes to copy
+ *
+ * Return: the copy, NUL-terminated, or NULL on malloc failure
+ */
+char *arena_copy(arena_t *a, char *s, size_t n)
+{
+	char *copy = arena_alloc(a, n + 1);
+
+	if (!copy)
+		return (NULL);
+	memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
@@ -0,0 +1,49 @@
+#include "shell.h"
+
+/**
+ * arena_mark - records how far an arena is used
+ * @a: the arena
+ *
+ * Return: the mark, for arena_release()
+ */
+arena_mark_t arena_mark(arena_t *a)
+{
+	arena_mark_t mark;
+
+	mark.cur = a->cur;
+	mark.used = a->used;
+	return (mark);
+}
+
+/**
+ * arena_release - lets go of everything allocated since a mark in one
+ * step; the blocks are kept, so the next command allocates nothing
+ * @a: the arena
+ * @mark: the mark
+ *
+ * Return: void
+ */
+void arena_release(arena_t *a, arena_mark_t mark)
+{
+	a->cur = mark.cur;
+	a->used = mark.used;
+}
+
+/**
+ * arena_free - frees the blocks of an arena
+ * @a: the arena
+ *
+ * Return: void
+ */
+void arena_free(arena_t *a)
+{
+	chunk_t *next;
+
+	for (; a->head; a->head = next)
+	{
+		next = a->head->next;
+		free(a->head);
+	}
+	a->cur = NULL;
+	a->used = 0;
+}
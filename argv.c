@@ -0,0 +1,130 @@
+#include "shell.h"
+
+/**
+ * set_argv - expands the words of a command into info->argv, the fields
+ * and the pointers to them both in the arena
+ * @info: the parameter struct
+ * @words: the words as written
+ * @n: the number of words
+ *
+ * Return: 0 on success, 1 on error; a command whose words all expanded
+ *         to nothing gets the argv of an empty command, {"", NULL}
+ */
+int set_argv(info_t *info, char **words, int n)
+{
+	info->argc = expand_fields(info, words, n, EXP_SPLIT | EXP_GLOB,
+			&(info->argv));
+	if (info->argc < 0)
+		return (1);
+	if (info->argc)
+		return (0);
+	info->argv = arena_alloc(&(info->arena), sizeof(char *) * 2);
+	if (!info->argv)
+		return (1);
+	info->argv[0] = "";
+	info->argv[1] = NULL;
+	info->argc = 1;
+	return (0);
+}
+
+/**
+ * is_assignment - checks if a word is a NAME=value assignment
+ * @word: the word as written
+ *
+ * Return: the length of the name, 0 if it is no assignment
+ */
+size_t is_assignment(char *word)
+{
+	size_t n = 0;
+
+	if (char_class[(unsigned char)*word] & CC_DIGIT)
+		return (0);
+	while (char_class[(unsigned char)word[n]] & CC_NAME)
+		n++;
+	return (n && word[n] == '=' ? n : 0);
+}
+
+/**
+ * save_var - records the value a variable has before a command's
+ * assignment replaces it, as NAME=value, or NAME if it is unset
+ * @info: the parameter struct
+ * @name: the name
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int save_var(info_t *info, char *name)
+{
+	char *old = env_value(info, name), *saved;
+	size_t len = _strlen(name) + 1;
+
+	saved = arena_alloc(&(info->arena), len + (old ? _strlen(old) + 1 : 0));
+	if (!saved)
+		return (1);
+	_strcpy(saved, name);
+	if (old)
+	{
+		_strcat(saved, "=");
+		_strcat(saved, old);
+	}
+	info->saved_vars[info->nsaved++] = saved;
+	return (0);
+}
+
+/**
+ * set_assigns - carries out the assignments in front of a command, for
+ * good if there is no command, or only until it is done otherwise
+ * @info: the parameter struct
+ * @words: the assignment words as written
+ * @n: the number of them
+ * @temporary: on if a command follows, see restore_assigns()
+ *
+ * Return: 0 on success, 1 on error
+ */
+int set_assigns(info_t *info, char **words, int n, int temporary)
+{
+	char *name, *value;
+	size_t len;
+	int i;
+
+	info->nsaved = 0;
+	if (temporary && n)
+	{
+		info->saved_vars = arena_alloc(&(info->arena), sizeof(char *) * n);
+		if (!info->saved_vars)
+			return (1);
+	}
+	for (i = 0; i < n; i++)
+	{
+		len = is_assignment(words[i]);
+		name = arena_copy(&(info->arena), words[i], len);
+		value = name ? expand_word(info, words[i] + len + 1, 0) : NULL;
+		if (!value || (temporary && save_var(info, name)))
+			return (1);
+		if (_setenv(info, name, value))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * restore_assigns - puts back the variables a command's assignments
+ * replaced, latest first so a name assigned twice gets its first value
+ * @info: the parameter struct
+ */
+void restore_assigns(info_t *info)
+{
+	char *saved, *eq;
+
+	while (info->nsaved > 0)
+	{
+		saved = info->saved_vars[--info->nsaved];
+		eq = _strchr(saved, '=');
+		if (!eq)
+		{
+			_unsetenv(info, saved);
+			continue;
+		}
+		*eq = '\0';
+		_setenv(info, saved, eq + 1);
+	}
+}
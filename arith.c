@@ -0,0 +1,157 @@
+#include "shell.h"
+
+/**
+ * arith_error - reports an arithmetic expression that cannot be evaluated
+ * @a: the evaluator
+ * @msg: what is wrong with it
+ *
+ * Return: 1, for the evaluator to return; see shell_error()
+ */
+int arith_error(arith_t *a, char *msg)
+{
+	_eputs(a->info->fname);
+	_eputs(": ");
+	print_d(a->info->line_count, STDERR_FILENO);
+	_eputs(": arithmetic expression: ");
+	_eputs(msg);
+	_eputs(": \"");
+	_eputs(a->expr);
+	_eputs("\"\n");
+	shell_error(a->info);
+	return (1);
+}
+
+/**
+ * arith_primary - evaluates a constant, decimal, octal with a leading 0
+ * or hexadecimal with a leading 0x, or a variable, which may be assigned
+ * @a: the evaluator
+ * @v: receives the value
+ *
+ * Return: 0 on success, 1 on error
+ */
+int arith_primary(arith_t *a, long *v)
+{
+	char *name = a->p, *end;
+	size_t n = 0;
+
+	if (char_class[(unsigned char)*name] & CC_DIGIT)
+	{
+		errno = 0;
+		*v = strtol(name, &end, 0);
+		if (errno || char_class[(unsigned char)*end] & CC_NAME)
+			return (arith_error(a, "bad number"));
+		a->p = end;
+		return (0);
+	}
+	while (char_class[(unsigned char)name[n]] & CC_NAME)
+		n++;
+	if (!n)
+		return (arith_error(a, "expecting primary"));
+	a->p += n;
+	return (arith_assign(a, name, n, v));
+}
+
+/**
+ * arith_unary - evaluates a unary +, -, ~ or ! expression, a parenthesized
+ * expression or a primary
+ * @a: the evaluator
+ * @v: receives the value
+ *
+ * Return: 0 on success, 1 on error
+ */
+int arith_unary(arith_t *a, long *v)
+{
+	char c;
+
+	arith_space(a);
+	c = *a->p;
+	if (c && _strchr("+-~!", c))
+	{
+		a->p++;
+		if (arith_unary(a, v))
+			return (1);
+		if (c == '-')
+			*v = -(unsigned long)*v;
+		else if (c != '+')
+			*v = c == '~' ? ~*v : !*v;
+		return (0);
+	}
+	if (c != '(')
+		return (arith_primary(a, v));
+	a->p++;
+	if (arith_expr(a, v))
+		return (1);
+	arith_space(a);
+	if (*a->p != ')')
+		return (arith_error(a, "expecting ')'"));
+	a->p++;
+	return (0);
+}
+
+/**
+ * arith_binary - evaluates binary operators by precedence climbing: the
+ * operand on the right of an operator takes the operators that bind
+ * tighter than it before it is applied
+ * @a: the evaluator
+ * @min: the lowest precedence to take, see arith_op()
+ * @v: receives the value
+ *
+ * Return: 0 on success, 1 on error
+ */
+int arith_binary(arith_t *a, int min, long *v)
+{
+	int prec, skip = a->skip;
+	const char *o;
+	long r;
+
+	if (arith_unary(a, v))
+		return (1);
+	for (;;)
+	{
+		o = arith_op(a, &prec);
+		if (!o || prec < min)
+			return (0);
+		a->p += _strlen((char *)o);
+		if ((o[1] == '|' && *v) || (o[1] == '&' && !*v))
+			a->skip = 1;
+		if (arith_binary(a, prec + 1, &r))
+			return (1);
+		a->skip = skip;
+		if (arith_apply(a, o, v, r))
+			return (1);
+	}
+}
+
+/**
+ * arith_expr - evaluates an expression, the lowest precedence being that
+ * of cond ? expr : expr, of which only the operand chosen is evaluated
+ * @a: the evaluator
+ * @v: receives the value
+ *
+ * Return: 0 on success, 1 on error
+ */
+int arith_expr(arith_t *a, long *v)
+{
+	int skip = a->skip;
+	long t, f;
+
+	if (arith_binary(a, 1, v))
+		return (1);
+	arith_space(a);
+	if (*a->p != '?')
+		return (0);
+	a->p++;
+	a->skip = skip || !*v;
+	if (arith_expr(a, &t))
+		return (1);
+	arith_space(a);
+	if (*a->p != ':')
+		return (arith_error(a, "expecting ':'"));
+	a->p++;
+	a->skip = skip || *v;
+	if (arith_expr(a, &f))
+		return (1);
+	a->skip = skip;
+	*v = *v ? t : f;
+	return (0);
+}
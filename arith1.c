@@ -0,0 +1,148 @@
+#include "shell.h"
+
+/**
+ * arith_space - skips the blanks and newlines in an expression
+ * @a: the evaluator
+ */
+void arith_space(arith_t *a)
+{
+	while (*a->p == ' ' || *a->p == '\t' || *a->p == '\n')
+		a->p++;
+}
+
+/**
+ * arith_op - finds the binary operator next in an expression, trying the
+ * longer operators that start like a shorter one first
+ * @a: the evaluator
+ * @prec: receives its precedence, from 1 for || to 10 for * / %
+ *
+ * Return: the operator, not consumed, or NULL if there is none
+ */
+const char *arith_op(arith_t *a, int *prec)
+{
+	static const char * const ops[] = {"||", "&&", "|", "^", "&", "==",
+		"!=", "<=", ">=", "<<", ">>", "<", ">", "+", "-", "*", "/", "%",
+		NULL};
+	static const int precs[] = {1, 2, 3, 4, 5, 6, 6, 7, 7, 8, 8, 7, 7, 9,
+		9, 10, 10, 10};
+	int i;
+
+	arith_space(a);
+	for (i = 0; ops[i]; i++)
+		if (!strncmp(a->p, ops[i], _strlen((char *)ops[i])))
+			return (*prec = precs[i], ops[i]);
+	return (NULL);
+}
+
+/**
+ * arith_apply - applies a binary operator, or the operator of an
+ * assignment such as +=, wrapping around on overflow
+ * @a: the evaluator
+ * @o: the operator
+ * @v: the left operand, receives the result
+ * @r: the right operand
+ *
+ * Return: 0 on success, 1 on division by zero
+ */
+int arith_apply(arith_t *a, const char *o, long *v, long r)
+{
+	unsigned long l = *v;
+
+	if ((*o == '/' || *o == '%') && !r)
+		return (a->skip ? (*v = 0) : arith_error(a, "division by zero"));
+	if (*o == '/' || *o == '%')
+		*v = r == -1 ? (*o == '/' ? (long)-l : 0) :
+			(*o == '/' ? *v / r : *v % r);
+	else if (*o == '|' || *o == '&')
+		*v = o[1] == *o ? (*o == '|' ? *v || r : *v && r) :
+			(long)(*o == '|' ? l | r : l & r);
+	else if (*o == '<' || *o == '>')
+		*v = o[1] == '=' ? (*o == '<' ? *v <= r : *v >= r) :
+			o[1] != *o ? (*o == '<' ? *v < r : *v > r) :
+			*o == '<' ? (long)(l << (r & 63)) : *v >> (r & 63);
+	else if (*o == '=' || *o == '!')
+		*v = (*v == r) == (*o == '=');
+	else
+		*v = *o == '^' ? (long)(l ^ r) : *o == '+' ? (long)(l + r) :
+			*o == '-' ? (long)(l - r) : (long)(l * r);
+	return (0);
+}
+
+/**
+ * arith_assign - evaluates a variable, or an assignment to it if one of
+ * = *= /= %= += -= <<= >>= &= ^= |= follows its name
+ * @a: the evaluator, just past the name
+ * @name: the name
+ * @n: its length
+ * @v: receives the value
+ *
+ * Return: 0 on success, 1 on error
+ */
+int arith_assign(arith_t *a, char *name, size_t n, long *v)
+{
+	static const char * const assigns[] = {"=", "*=", "/=", "%=", "+=",
+		"-=", "<<=", ">>=", "&=", "^=", "|=", NULL};
+	const char *o;
+	long r;
+	int i;
+
+	arith_space(a);
+	for (i = 0; assigns[i]; i++)
+		if (!strncmp(a->p, assigns[i], _strlen((char *)assigns[i])))
+			break;
+	*v = 0;
+	if (!a->skip && arith_get(a->info, name, n, v))
+		return (arith_error(a, "bad number in variable"));
+	if (!assigns[i] || (!i && a->p[1] == '='))
+		return (0);
+	o = assigns[i];
+	a->p += _strlen((char *)o);
+	if (arith_expr(a, &r))
+		return (1);
+	if (!i)
+		*v = r;
+	else if (arith_apply(a, o, v, r))
+		return (1);
+	if (!a->skip && arith_set(a->info, name, n, *v))
+		return (1);
+	return (0);
+}
+
+/**
+ * exp_arith - expands $((expression)): the expression is expanded like
+ * text in double quotes, then evaluated in the shell's own process; a
+ * $((...)) whose inner parentheses do not close at the end, such as
+ * $((cd a) && (cd b)), is a command substitution of a subshell instead
+ * @e: the expander
+ * @s: the '$'
+ * @dq: on inside double quotes
+ *
+ * Return: a pointer past the closing "))", or NULL on error
+ */
+char *exp_arith(expand_t *e, char *s, int dq)
+{
+	char *end = skip_subst(s), *num, *p;
+	int depth = 0;
+	arith_t a;
+	long text, v;
+
+	for (p = s + 3; end && p < end - 1 && depth >= 0; p++)
+		depth += (*p == '(') - (*p == ')');
+	if (!end || end[-1] != ')' || depth)
+		return (exp_subst(e, s, dq));
+	text = exp_temp(e, s + 3, end - 1, 0);
+	if (text < 0)
+		return (NULL);
+	a.info = e->info;
+	a.expr = a.p = e->buf + text;
+	a.skip = 0;
+	arith_space(&a);
+	v = 0;
+	if (*a.p && arith_expr(&a, &v))
+		return (NULL);
+	arith_space(&a);
+	if (*a.p)
+		return (arith_error(&a, "unexpected text"), NULL);
+	num = convert_number(v, 10, 0);
+	return (exp_value(e, num, _strlen(num), dq) ? NULL : end + 1);
+}
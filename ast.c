@@ -0,0 +1,84 @@
+#include "shell.h"
+
+/**
+ * new_node - allocates a syntax tree node in the arena
+ * @lx: the lexer
+ * @type: one of NODE_*
+ * @left: the first operand, or NULL
+ * @right: the second operand, or NULL
+ *
+ * Return: the node, or NULL on malloc failure
+ */
+node_t *new_node(lexer_t *lx, int type, node_t *left, node_t *right)
+{
+	node_t *node = arena_alloc(&(lx->info->arena), sizeof(node_t));
+
+	if (!node)
+		return (NULL);
+	node->type = type;
+	node->words = NULL;
+	node->nwords = 0;
+	node->redirs = NULL;
+	node->line = left ? left->line : 0;
+	node->left = left;
+	node->right = right;
+	node->next = NULL;
+	return (node);
+}
+
+/**
+ * add_word - appends a word to a command node, doubling its vector
+ * @lx: the lexer
+ * @node: the command node
+ * @word: the word, in the arena
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int add_word(lexer_t *lx, node_t *node, char *word)
+{
+	char **words;
+	int n = node->nwords;
+
+	/* the capacity goes 4, 8, 16..., so it is full when n + 1 is one */
+	if (!node->words || (n >= 3 && !((n + 1) & n)))
+	{
+		words = arena_grow(&(lx->info->arena), node->words,
+				sizeof(char *) * (n + 1),
+				sizeof(char *) * (node->words ? (n + 1) * 2 : 4));
+		if (!words)
+			return (1);
+		node->words = words;
+	}
+	node->words[node->nwords++] = word;
+	node->words[node->nwords] = NULL;
+	return (0);
+}
+
+/**
+ * join_words - joins words with a separator
+ * @words: NULL-terminated words, may be NULL
+ * @sep: the separator
+ *
+ * Return: the malloc'ed string
+ */
+char *join_words(char **words, char *sep)
+{
+	size_t len = 1;
+	int i;
+	char *s;
+
+	for (i = 0; words && words[i]; i++)
+		len += _strlen(words[i]) + _strlen(sep);
+	s = malloc(len);
+	if (!s)
+		return (NULL);
+	*s = '\0';
+	for (i = 0; words && words[i]; i++)
+	{
+		if (i)
+			_strcat(s, sep);
+		_strcat(s, words[i]);
+	}
+	return (s);
+}
+
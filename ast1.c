@@ -0,0 +1,69 @@
+#include "shell.h"
+
+/**
+ * text_part - renders one piece of a node for node_text()
+ * @node: the node
+ * @code: L, R or E for the left, right or else part, W for the words,
+ *        1 for the first word, * for the others, | for the words as
+ *        case patterns, S for the separator after the left part
+ *
+ * Return: the malloc'ed text
+ */
+char *text_part(node_t *node, char code)
+{
+	char *text, *parts[3];
+
+	if (code == 'L' || code == 'R')
+		node = code == 'L' ? node->left : node->right;
+	else if (code == 'E' && node->next)
+	{
+		parts[0] = "; else ";
+		parts[1] = node_text(node->next);
+		parts[2] = NULL;
+		text = parts[1] ? join_words(parts, "") : NULL;
+		free(parts[1]);
+		return (text);
+	}
+	if ((code == 'L' || code == 'R') && node)
+		return (node_text(node));
+	if (code == 'W' || code == '|')
+		return (join_words(node->words, code == '|' ? " | " : " "));
+	if (code == '1' || code == '*')
+		return (code == '1' ? _strdup(node->words[0]) :
+				join_words(node->words + 1, " "));
+	if (code == 'S')
+		return (_strdup(node->left->type == NODE_BG ? " " : "; "));
+	return (_strdup(""));
+}
+
+/**
+ * node_text - rebuilds the command text of a tree, for `jobs`
+ * @node: the root
+ *
+ * Return: the malloc'ed text, or NULL on malloc failure
+ */
+char *node_text(node_t *node)
+{
+	static char * const formats[] = {"%W", "%L | %R", "%L && %R",
+		"%L || %R", "%L%S%R", "%L &", "if %L; then %R%E; fi",
+		"while %L; do %R; done", "until %L; do %R; done",
+		"for %1 in %*; do %L; done", "case %1 in %L esac", "%|) %L;; %R"};
+	char *fmt = formats[node->type], *parts[16], *text;
+	int i, n = 0, ok = 1;
+
+	while (*fmt)
+	{
+		for (i = 0; fmt[i] && fmt[i] != '%'; i++)
+			;
+		if (i)
+			parts[n] = lex_copy(fmt, i), fmt += i;
+		else
+			parts[n] = text_part(node, fmt[1]), fmt += 2;
+		ok = ok && parts[n++];
+	}
+	parts[n] = NULL;
+	text = ok ? join_words(parts, "") : NULL;
+	for (i = 0; i < n; i++)
+		free(parts[i]);
+	return (text);
+}
@@ -12,16 +12,16 @@ int shell_exit(info_t *info)
 
     if (info->argv[1])  /* Checking for exit argument */
     {
-        exit_status = parse_error_integer(info->argv[1]);
+        exit_status = _erratoi(info->argv[1]);
         if (exit_status == -1)
         {
             info->status = 2;
-            display_error_message(info, "Invalid number: ");
-            custom_print(info->argv[1]);
-            custom_putchar('\n');
-            return (1);
+            print_error(info, "Invalid number: ");
+            _puts(info->argv[1]);
+            _putchar('\n');
+            return (2);
         }
-        info->err_num = parse_error_integer(info->argv[1]);
+        info->err_num = _erratoi(info->argv[1]);
         return (-2);
     }
     info->err_num = -1;
@@ -40,24 +40,24 @@ int shell_change_dir(info_t *info)
 
     current_dir = getcwd(dir_buffer, 1024);
     if (!current_dir)
-        custom_print("Error: Could not fetch current directory.\n");
+        _puts("Error: Could not fetch current directory.\n");
 
     if (!info->argv[1])
     {
-        target_dir = fetch_environment_var(info, "HOME=");
-        dir_change_status = target_dir ? chdir(target_dir) : chdir(fetch_environment_var(info, "PWD="));
+        target_dir = _getenv(info, "HOME=");
+        dir_change_status = target_dir ? chdir(target_dir) : chdir(_getenv(info, "PWD="));
     }
-    else if (str_compare(info->argv[1], "-") == 0)
+    else if (_strcmp(info->argv[1], "-") == 0)
     {
-        if (!fetch_environment_var(info, "OLDPWD="))
+        if (!_getenv(info, "OLDPWD="))
         {
-            custom_print(current_dir);
-            custom_putchar('\n');
+            _puts(current_dir);
+            _putchar('\n');
             return (1);
         }
-        custom_print(fetch_environment_var(info, "OLDPWD="));
-        custom_putchar('\n');
-        dir_change_status = chdir(fetch_environment_var(info, "OLDPWD="));
+        _puts(_getenv(info, "OLDPWD="));
+        _putchar('\n');
+        dir_change_status = chdir(_getenv(info, "OLDPWD="));
     }
     else
     {
@@ -66,14 +66,14 @@ int shell_change_dir(info_t *info)
 
     if (dir_change_status == -1)
     {
-        display_error_message(info, "Failed to change directory to ");
-        custom_print(info->argv[1]);
-        custom_putchar('\n');
+        print_error(info, "Failed to change directory to ");
+        _puts(info->argv[1]);
+        _putchar('\n');
     }
     else
     {
-        update_environment_var(info, "OLDPWD", fetch_environment_var(info, "PWD="));
-        update_environment_var(info, "PWD", getcwd(dir_buffer, 1024));
+        _setenv(info, "OLDPWD", _getenv(info, "PWD="));
+        _setenv(info, "PWD", getcwd(dir_buffer, 1024));
     }
     return (0);
 }
@@ -85,8 +85,8 @@ int shell_change_dir(info_t *info)
  */
 int shell_help(info_t *info)
 {
-    (void)info; // Ignoring unused parameter
+    (void)info; /* Ignoring unused parameter */
 
-    custom_print("Help command invoked. Awaiting full implementation.\n");
+    _puts("Help command invoked. Awaiting full implementation.\n");
     return (0);
 }
@@ -1,32 +1,43 @@
 #include "shell.h"
 
 /**
- * display_history - Show the command history, starting at 0.
+ * display_history - Show the command history, numbered; with -s, only
+ * the entries with a pattern in them, see hist_search().
  * @info: Struct holding potential arguments.
- * Return: 0 after executing.
+ * Return: 0 after executing, the status of the search with -s.
  */
 int display_history(info_t *info)
 {
-    show_list(info->history);
+    char **av = info->argv;
+
+    if (av[1] && !_strcmp(av[1], "-s"))
+    {
+        if (av[2] && (!av[3] || (!_strcmp(av[3], "-n") && av[4] && !av[5])))
+            return (hist_search(info, av[2], av[3] ? av[4] : NULL));
+        _eputs("history: usage: history -s pattern [-n count]\n");
+        return (2);
+    }
+    hist_show(&(info->history), NULL, hist_count(&(info->history)));
     return (0);
 }
 
 /**
  * remove_alias - Remove an alias by name.
  * @info: Parameter structure.
- * @alias_name: Alias to remove.
+ * @alias_name: Alias to remove, as 'alias='.
  * Return: 0 if successful, 1 if an error occurred.
  */
 int remove_alias(info_t *info, char *alias_name)
 {
     char *separator, tmp;
+    int result;
 
-    separator = find_char(alias_name, '=');
+    separator = _strchr(alias_name, '=');
     if (!separator)
         return (1);
     tmp = *separator;
     *separator = '\0';
-    int result = remove_node(&(info->alias), get_index(info->alias, starts_with(info->alias, alias_name)));
+    result = alias_unset(info, alias_name);
     *separator = tmp;
 
     return (result);
@@ -41,41 +52,41 @@ int remove_alias(info_t *info, char *alias_name)
 int define_alias(info_t *info, char *alias_str)
 {
     char *separator;
+    int result;
 
-    separator = find_char(alias_str, '=');
+    separator = _strchr(alias_str, '=');
     if (!separator)
         return (1);
     if (!*(separator + 1))
         return (remove_alias(info, alias_str));
 
-    remove_alias(info, alias_str);
-    return (append_to_list(&(info->alias), alias_str) == NULL);
+    *separator = '\0';
+    result = alias_set(info, alias_str, separator + 1);
+    *separator = '=';
+    return (result);
 }
 
 /**
  * show_alias - Print the alias.
- * @item: Node containing the alias.
+ * @item: The alias.
  * Return: 0 if successful, 1 if an error occurred.
  */
-int show_alias(list_t *item)
+int show_alias(alias_t *item)
 {
-    char *separator = NULL, *alias = NULL;
-
     if (item)
     {
-        separator = find_char(item->str, '=');
-        for (alias = item->str; alias <= separator; alias++)
-            write_char(*alias);
-        write_str("'");
-        write_str(separator + 1);
-        write_str("'\n");
+        _puts(item->name);
+        _puts("='");
+        _puts(item->value);
+        _puts("'\n");
         return (0);
     }
     return (1);
 }
 
 /**
- * handle_alias - Simulate the 'alias' command.
+ * handle_alias - Simulate the 'alias' command; with no arguments, the
+ * aliases are listed sorted by name.
  * @info: Structure containing arguments.
  * Return: 0 upon completion.
  */
@@ -83,26 +94,17 @@ int handle_alias(info_t *info)
 {
     int idx;
     char *separator = NULL;
-    list_t *entry = NULL;
 
     if (info->argc == 1)
-    {
-        entry = info->alias;
-        while (entry)
-        {
-            show_alias(entry);
-            entry = entry->next;
-        }
-        return (0);
-    }
+        return (alias_list(info));
 
     for (idx = 1; info->argv[idx]; idx++)
     {
-        separator = find_char(info->argv[idx], '=');
+        separator = _strchr(info->argv[idx], '=');
         if (separator)
             define_alias(info, info->argv[idx]);
         else
-            show_alias(matches_start(info->alias, info->argv[idx]));
+            show_alias(alias_find(info, info->argv[idx]));
     }
 
     return (0);
@@ -0,0 +1,74 @@
+#include "shell.h"
+
+/**
+ * _myhash - lists, fills or flushes the resolved command table
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 if a named command could not be found
+ */
+int _myhash(info_t *info)
+{
+	int i, ret = 0;
+	char *path;
+
+	if (info->argc == 1)
+	{
+		if (!print_hash(info))
+			_puts("hash: hash table empty\n");
+		return (0);
+	}
+	if (_strcmp(info->argv[1], "-r") == 0)
+	{
+		hash_clear(info);
+		return (0);
+	}
+	for (i = 1; info->argv[i]; i++)
+	{
+		if (getBuiltin(info->argv[i]))
+			continue;
+		path = findPath(info, _getenv(info, "PATH="), info->argv[i]);
+		if (!path)
+		{
+			_eputs("hash: ");
+			_eputs(info->argv[i]);
+			_eputs(": not found\n");
+			ret = 1;
+		}
+	}
+	return (ret);
+}
+
+/**
+ * _mycommand - implements `command -v`, describing how a name resolves
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 if every name was found, 1 otherwise, 2 on usage error
+ */
+int _mycommand(info_t *info)
+{
+	int i, ret = 0;
+	char *path;
+
+	if (info->argc < 3 || _strcmp(info->argv[1], "-v"))
+	{
+		_eputs("command: usage: command -v name [name ...]\n");
+		return (2);
+	}
+	for (i = 2; info->argv[i]; i++)
+	{
+		if (getBuiltin(info->argv[i]))
+			path = info->argv[i];
+		else if (_strchr(info->argv[i], '/'))
+			path = isCommand(info, info->argv[i]) ? info->argv[i] : NULL;
+		else
+			path = findPath(info, _getenv(info, "PATH="), info->argv[i]);
+		if (!path)
+		{
+			ret = 1;
+			continue;
+		}
+		_puts(path);
+		_putchar('\n');
+	}
+	return (ret);
+}
@@ -0,0 +1,155 @@
+#include "shell.h"
+
+/**
+ * _myjobs - lists the background jobs
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: Always 0
+ */
+int _myjobs(info_t *info)
+{
+	job_t *job, *next;
+	int i, pids_only = info->argc > 1 && !_strcmp(info->argv[1], "-p");
+
+	reap_jobs(info);
+	for (job = info->jobs; job; job = next)
+	{
+		next = job->next;
+		if (!pids_only)
+			print_job(job);
+		for (i = 0; pids_only && i < job->npids; i++)
+			if (job->pids[i])
+			{
+				_puts(convert_number(job->pids[i] < 0 ?
+							-job->pids[i] : job->pids[i], 10, 0));
+				_putchar('\n');
+			}
+		if (job->state == JOB_DONE)
+			remove_job(info, job);
+	}
+	return (0);
+}
+
+/**
+ * wait_next - implements `wait -n`, waiting for any one job to finish
+ * @info: the parameter struct
+ *
+ * Return: the status of that job, 127 if there is nothing to wait for
+ */
+int wait_next(info_t *info)
+{
+	job_t *job;
+	pid_t pid;
+	int wstatus, status;
+
+	while (1)
+	{
+		for (job = info->jobs; job; job = job->next)
+			if (job->state == JOB_DONE)
+			{
+				status = job->status;
+				remove_job(info, job);
+				return (status);
+			}
+		for (job = info->jobs; job && job->state != JOB_RUNNING;)
+			job = job->next;
+		if (!job)
+			return (127);
+		pid = waitpid(-1, &wstatus, 0);
+		if (pid == -1 && errno != EINTR)
+			return (127);
+		if (pid > 0)
+			update_job(info, pid, wstatus);
+	}
+}
+
+/**
+ * _mywait - waits for background jobs: wait [-n] [pid|%n ...]
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: the status of the last job waited for, 127 if unknown
+ */
+int _mywait(info_t *info)
+{
+	job_t *job, *next;
+	int i, status = 0;
+
+	if (info->argc > 1 && !_strcmp(info->argv[1], "-n"))
+		return (wait_next(info));
+	for (job = info->jobs; info->argc == 1 && job; job = next)
+	{
+		next = job->next;
+		wait_job(info, job);
+		if (job->state == JOB_DONE)
+			remove_job(info, job);
+	}
+	for (i = 1; i < info->argc; i++)
+	{
+		job = find_job(info, info->argv[i]);
+		if (!job)
+		{
+			status = 127;
+			continue;
+		}
+		status = wait_job(info, job);
+		if (job->state == JOB_DONE)
+			remove_job(info, job);
+	}
+	return (status);
+}
+
+/**
+ * _myfg - continues a job in the foreground and waits for it
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: the status of the job, 1 if there is no such job
+ */
+int _myfg(info_t *info)
+{
+	job_t *job = find_job(info, info->argv[1]);
+	int status;
+
+	if (!job)
+	{
+		print_error(info, "no such job\n");
+		return (1);
+	}
+	_puts(job->cmd);
+	_putchar('\n');
+	_putchar(BUF_FLUSH);
+	set_foreground(info, job->pgid);
+	if (job->state == JOB_STOPPED)
+	{
+		kill_job(info, job, SIGCONT);
+		job->state = JOB_RUNNING;
+	}
+	status = wait_job(info, job);
+	set_foreground(info, getpgrp());
+	if (job->state == JOB_DONE)
+		remove_job(info, job);
+	else
+		print_job(job);
+	return (status);
+}
+
+/**
+ * _mybg - continues a stopped job in the background
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 if there is no such job
+ */
+int _mybg(info_t *info)
+{
+	job_t *job = find_job(info, info->argv[1]);
+
+	if (!job)
+	{
+		print_error(info, "no such job\n");
+		return (1);
+	}
+	if (job->state == JOB_STOPPED)
+		kill_job(info, job, SIGCONT);
+	job->state = job->state == JOB_DONE ? JOB_DONE : JOB_RUNNING;
+	print_job(job);
+	return (0);
+}
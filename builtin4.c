@@ -0,0 +1,120 @@
+#include "shell.h"
+
+/**
+ * _myecho - prints its arguments, like /bin/echo with -n, -e and -E
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: Always 0
+ */
+int _myecho(info_t *info)
+{
+	int i, j, newline = 1, escapes = 0, stop = 0;
+	char **av = info->argv;
+
+	for (i = 1; av[i] && av[i][0] == '-' && av[i][1]; i++)
+	{
+		for (j = 1; av[i][j] && _strchr("neE", av[i][j]); j++)
+			;
+		if (av[i][j])
+			break;
+		for (j = 1; av[i][j]; j++)
+		{
+			if (av[i][j] == 'n')
+				newline = 0;
+			else
+				escapes = av[i][j] == 'e';
+		}
+	}
+	for (; av[i] && !stop; i++)
+	{
+		if (escapes)
+			print_escapes(av[i], &stop);
+		else
+			_puts(av[i]);
+		if (av[i + 1] && !stop)
+			_putchar(' ');
+	}
+	if (newline && !stop)
+		_putchar('\n');
+	return (0);
+}
+
+/**
+ * _mytrue - implements both `true` and `false`
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 1 when invoked as false, 0 otherwise
+ */
+int _mytrue(info_t *info)
+{
+	return (info->argv[0][0] == 'f');
+}
+
+/**
+ * _mypwd - prints the current working directory
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 on error
+ */
+int _mypwd(info_t *info)
+{
+	char buf[PATH_MAX];
+
+	if (!getcwd(buf, sizeof(buf)))
+	{
+		print_error(info, "can't get the current directory\n");
+		return (1);
+	}
+	_puts(buf);
+	_putchar('\n');
+	return (0);
+}
+
+/**
+ * is_test_binary - checks if a word is a binary operator of test
+ * @op: the word
+ *
+ * Return: 1 if it is, 0 otherwise
+ */
+int is_test_binary(char *op)
+{
+	char *ops[] = {"=", "==", "!=", "-eq", "-ne", "-lt", "-le", "-gt",
+		"-ge", NULL};
+	int i;
+
+	for (i = 0; ops[i]; i++)
+		if (!_strcmp(op, ops[i]))
+			return (1);
+	return (0);
+}
+
+/**
+ * _mytest - implements `test expr` and `[ expr ]`
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 if the expression is true, 1 if false, 2 on error
+ */
+int _mytest(info_t *info)
+{
+	int i = 1, n = info->argc, r;
+
+	if (!_strcmp(info->argv[0], "["))
+	{
+		if (_strcmp(info->argv[n - 1], "]"))
+		{
+			print_error(info, "missing ]\n");
+			return (2);
+		}
+		n--;
+	}
+	if (n == 1)
+		return (1);
+	r = test_or(info, &i, n);
+	if (r != 2 && i < n)
+	{
+		print_error(info, info->argv[i]);
+		_eputs(": unexpected operator\n");
+		r = 2;
+	}
+	return (r);
+}
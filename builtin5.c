@@ -0,0 +1,134 @@
+#include "shell.h"
+
+/**
+ * _myprintf - formats and prints its arguments, reusing the format
+ * until every argument has been consumed
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 if a conversion failed, 2 on usage error
+ */
+int _myprintf(info_t *info)
+{
+	char **args, **prev;
+	int ret = 0, stop = 0;
+
+	if (info->argc < 2)
+	{
+		print_error(info, "usage: printf format [arguments]\n");
+		return (2);
+	}
+	args = info->argv + 2;
+	do {
+		prev = args;
+		ret |= printf_format(info, info->argv[1], &args, &stop);
+	} while (*args && args != prev && !stop);
+	return (ret);
+}
+
+/**
+ * get_signals - returns the table of signal names known to kill
+ *
+ * Return: array of name/number pairs ending with a NULL name
+ */
+signame_t *get_signals(void)
+{
+	static signame_t signals[] = {
+		{"HUP", SIGHUP}, {"INT", SIGINT}, {"QUIT", SIGQUIT},
+		{"ILL", SIGILL}, {"TRAP", SIGTRAP}, {"ABRT", SIGABRT},
+		{"BUS", SIGBUS}, {"FPE", SIGFPE}, {"KILL", SIGKILL},
+		{"USR1", SIGUSR1}, {"SEGV", SIGSEGV}, {"USR2", SIGUSR2},
+		{"PIPE", SIGPIPE}, {"ALRM", SIGALRM}, {"TERM", SIGTERM},
+		{"CHLD", SIGCHLD}, {"CONT", SIGCONT}, {"STOP", SIGSTOP},
+		{"TSTP", SIGTSTP}, {"TTIN", SIGTTIN}, {"TTOU", SIGTTOU},
+		{"URG", SIGURG}, {"XCPU", SIGXCPU}, {"XFSZ", SIGXFSZ},
+		{"VTALRM", SIGVTALRM}, {"PROF", SIGPROF}, {"WINCH", SIGWINCH},
+		{"SYS", SIGSYS}, {NULL, 0}
+	};
+
+	return (signals);
+}
+
+/**
+ * sig_number - maps a signal name or number to the signal number
+ * @name: e.g. "TERM", "SIGTERM" or "15"
+ *
+ * Return: the signal number, or -1 if it is not known
+ */
+int sig_number(char *name)
+{
+	signame_t *sig = get_signals();
+	char *end;
+	long n;
+
+	n = strtol(name, &end, 10);
+	if (*name && !*end)
+		return (n >= 0 && n < NSIG ? (int)n : -1);
+	if (starts_with(name, "SIG"))
+		name += 3;
+	for (; sig->name; sig++)
+		if (!_strcmp(name, sig->name))
+			return (sig->num);
+	return (-1);
+}
+
+/**
+ * kill_target - sends a signal to a pid or to a %job
+ * @info: the parameter struct
+ * @target: the pid or job specification
+ * @sig: the signal number
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int kill_target(info_t *info, char *target, int sig)
+{
+	job_t *job = NULL;
+	char *end;
+	pid_t pid = 0;
+
+	if (target[0] == '%')
+		job = find_job(info, target);
+	else
+	{
+		pid = (pid_t)strtol(target, &end, 10);
+		pid = *target && !*end ? pid : 0;
+	}
+	if (job ? kill_job(info, job, sig) : !pid || kill(pid, sig))
+	{
+		print_error(info, target);
+		_eputs(job || pid ? ": No such process\n" :
+				": arguments must be process or job IDs\n");
+		return (1);
+	}
+	if (job && job->state == JOB_STOPPED &&
+			sig != SIGSTOP && sig != SIGTSTP)
+		kill_job(info, job, SIGCONT);
+	return (0);
+}
+
+/**
+ * _mykill - sends a signal to processes or jobs:
+ * kill [-s sig | -sig] pid|%n ... or kill -l [sig ...]
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 if a target could not be signalled, 2 on usage
+ */
+int _mykill(info_t *info)
+{
+	int i = 1, signum = SIGTERM, ret = 0;
+
+	if (info->argc >= 2 && !_strcmp(info->argv[1], "-l"))
+		return (kill_list(info));
+	if (info->argc > 2 && !_strcmp(info->argv[1], "-s"))
+		signum = sig_number(info->argv[2]), i = 3;
+	else if (info->argc > 1 && info->argv[1][0] == '-' && info->argv[1][1])
+		signum = sig_number(info->argv[1] + 1), i = 2;
+	if (signum == -1 || i >= info->argc)
+	{
+		print_error(info, signum == -1 ? "invalid signal\n" :
+			"usage: kill [-s sigspec | -sigspec] pid | %job ...\n");
+		return (2);
+	}
+	for (; info->argv[i]; i++)
+		ret |= kill_target(info, info->argv[i], signum);
+	return (ret);
+}
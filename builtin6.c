@@ -0,0 +1,70 @@
+#include "shell.h"
+
+/**
+ * _mybreak - implements both `break [n]` and `continue [n]`, leaving
+ * the loops to unwind to eval_loop() and eval_for()
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 2 if n is not a positive number, which also
+ *         ends a script, see shell_error()
+ */
+int _mybreak(info_t *info)
+{
+	long n = 1;
+	char *end;
+
+	if (info->argc > 1)
+	{
+		n = strtol(info->argv[1], &end, 10);
+		if (*end || n < 1)
+		{
+			print_error(info, "Illegal number: ");
+			_eputs(info->argv[1]);
+			_eputchar('\n');
+			return (shell_error(info));
+		}
+	}
+	if (!info->loop_depth)
+		return (0);
+	info->skip = info->argv[0][0] == 'b' ? SKIP_BREAK : SKIP_CONT;
+	info->skip_count = n > info->loop_depth ? info->loop_depth : n;
+	return (0);
+}
+
+/**
+ * kill_list - implements `kill -l [sig ...]`: lists the signal names, or
+ * gives the name of each signal number, exit statuses above 128 included,
+ * and the number of each signal name
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 if an argument is not a known signal
+ */
+int kill_list(info_t *info)
+{
+	signame_t *sig;
+	int i, n, num, ret = 0;
+
+	for (sig = get_signals(); info->argc == 2 && sig->name; sig++)
+	{
+		_puts(sig->name);
+		_putchar('\n');
+	}
+	for (i = 2; i < info->argc; i++)
+	{
+		n = _erratoi(info->argv[i]);
+		num = n >= 0;
+		n = num ? (n > 128 ? n - 128 : n) : sig_number(info->argv[i]);
+		for (sig = get_signals(); sig->name && sig->num != n; sig++)
+			;
+		if (!sig->name)
+		{
+			print_error(info, info->argv[i]);
+			_eputs(": invalid signal\n");
+			ret = 1;
+			continue;
+		}
+		_puts(num ? sig->name : convert_number(n, 10, 0));
+		_putchar('\n');
+	}
+	return (ret);
+}
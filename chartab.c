@@ -0,0 +1,81 @@
+#include "shell.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * char_class - the CC_* classes of every byte, see shell.h; bytes above
+ * 127 are in no class
+ */
+const unsigned char char_class[256] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x04, 0x10, 0x08, 0x00, 0x02, 0x04,
+	0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x60, 0x60, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00,
+	0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40,
+	0x08, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00
+};
+
+#ifdef __SSE2__
+
+/**
+ * cc_next - finds the next byte the lexer has to look at: a CC_SPECIAL
+ * byte or the terminating '\0', sixteen bytes at a time
+ * @s: the string
+ *
+ * Description: the loads are aligned, so they never cross into a page
+ * the string does not reach, but they may read bytes past its end
+ * inside the last block, which AddressSanitizer would report.
+ * Return: a pointer to the byte
+ */
+__attribute__((no_sanitize_address))
+char *cc_next(char *s)
+{
+	static const char set[] = " \t;&|()<>'\"\\$`#";
+	const __m128i *p = (const __m128i *)((size_t)s & ~(size_t)15);
+	unsigned int mask = 0xffffu << (s - (char *)p), bits;
+	__m128i v, hit;
+	int i;
+
+	while (1)
+	{
+		v = _mm_load_si128(p);
+		hit = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+		for (i = 0; set[i]; i++)
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(set[i])));
+		bits = _mm_movemask_epi8(hit) & mask;
+		if (bits)
+			return ((char *)p + __builtin_ctz(bits));
+		mask = 0xffffu;
+		p++;
+	}
+}
+
+#else
+
+/**
+ * cc_next - finds the next byte the lexer has to look at: a CC_SPECIAL
+ * byte or the terminating '\0'
+ * @s: the string
+ *
+ * Return: a pointer to the byte
+ */
+char *cc_next(char *s)
+{
+	while (*s && !(char_class[(unsigned char)*s] & CC_SPECIAL))
+		s++;
+	return (s);
+}
+
+#endif
@@ -0,0 +1,145 @@
+#include "shell.h"
+
+/**
+ * index_dir - adds the names of the executable files in a directory to
+ * the command index, packed in one block that grows as it is read
+ * @ix: the index
+ * @dir: the directory, "" for the current one
+ *
+ * Return: 0 on success, even if the directory cannot be read; 1 on
+ *         malloc failure
+ */
+int index_dir(cmdindex_t *ix, char *dir)
+{
+	DIR *d = opendir(*dir ? dir : ".");
+	struct dirent *ent;
+	struct stat st;
+	char *grown;
+	size_t n;
+
+	while (d && (ent = readdir(d)) != NULL)
+	{
+		if (*ent->d_name == '.' || ent->d_type == DT_DIR ||
+				fstatat(dirfd(d), ent->d_name, &st, 0) ||
+				!S_ISREG(st.st_mode) || !(st.st_mode & 0111))
+			continue;
+		n = _strlen(ent->d_name) + 1;
+		if (ix->len + n > ix->size)
+		{
+			grown = _realloc(ix->names, ix->size, ix->size * 2 + 4096);
+			if (!grown)
+				return (closedir(d), 1);
+			ix->names = grown;
+			ix->size = ix->size * 2 + 4096;
+		}
+		memcpy(ix->names + ix->len, ent->d_name, n);
+		ix->len += n;
+		ix->count++;
+	}
+	if (d)
+		closedir(d);
+	return (0);
+}
+
+/**
+ * index_sort - sorts the pointers to the names in the command index,
+ * keeping one of each name found in more than one PATH directory
+ * @ix: the index, with sorted holding ix->count pointers
+ */
+void index_sort(cmdindex_t *ix)
+{
+	size_t i, n = 0;
+
+	qsort(ix->sorted, ix->count, sizeof(char *), glob_cmp);
+	for (i = 0; i < ix->count; i++)
+		if (!n || _strcmp(ix->sorted[n - 1], ix->sorted[i]))
+			ix->sorted[n++] = ix->sorted[i];
+	ix->count = n;
+}
+
+/**
+ * index_build - builds the index of the executables on PATH the first
+ * time a command is completed, and again once PATH has changed
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int index_build(info_t *info)
+{
+	cmdindex_t *ix = &(info->edit.index);
+	char *path = env_value(info, "PATH"), dir[PATH_MAX], *p;
+	size_t i, n;
+
+	path = path ? path : "";
+	if (ix->path && !_strcmp(ix->path, path))
+		return (0);
+	index_free(ix);
+	ix->path = _strdup(path);
+	if (!ix->path)
+		return (1);
+	for (p = *path ? path : NULL; p; p = p[n] ? p + n + 1 : NULL)
+	{
+		for (n = 0; p[n] && p[n] != ':'; n++)
+			;
+		if (n >= PATH_MAX)
+			continue;
+		memcpy(dir, p, n);
+		dir[n] = '\0';
+		if (index_dir(ix, dir))
+			return (index_free(ix), 1);
+	}
+	ix->sorted = malloc(sizeof(char *) * (ix->count + 1));
+	if (!ix->sorted)
+		return (index_free(ix), 1);
+	for (i = 0, p = ix->names; i < ix->count; i++, p += _strlen(p) + 1)
+		ix->sorted[i] = p;
+	index_sort(ix);
+	return (0);
+}
+
+/**
+ * index_find - finds the commands starting with a prefix by binary search
+ * @ix: the index
+ * @prefix: the prefix, not NUL-terminated
+ * @n: its length
+ * @count: receives the number of commands found
+ *
+ * Return: the position in ix->sorted of the first one
+ */
+size_t index_find(cmdindex_t *ix, char *prefix, size_t n, size_t *count)
+{
+	size_t lo = 0, hi = ix->count, mid, first;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (strncmp(ix->sorted[mid], prefix, n) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	first = lo;
+	hi = ix->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (strncmp(ix->sorted[mid], prefix, n) <= 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*count = lo - first;
+	return (first);
+}
+
+/**
+ * index_free - frees the command index, to be built again when needed
+ * @ix: the index
+ */
+void index_free(cmdindex_t *ix)
+{
+	free(ix->path);
+	free(ix->names);
+	free(ix->sorted);
+	_memset((void *)ix, 0, sizeof(cmdindex_t));
+}
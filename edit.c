@@ -0,0 +1,126 @@
+#include "shell.h"
+
+/**
+ * show_prompt - prints a prompt in interactive mode, remembering it for
+ * the line editor to print again after it lists completions
+ * @info: the parameter struct
+ * @prompt: the prompt
+ */
+void show_prompt(info_t *info, char *prompt)
+{
+	info->edit.prompt = prompt;
+	if (interactive(info))
+		_puts(prompt);
+}
+
+/**
+ * edit_raw - puts the terminal in raw mode for the line editor, so it
+ * gets each key as it is typed, or back in the mode it was in
+ * @info: the parameter struct
+ * @on: on to enter raw mode, off to leave it
+ *
+ * Return: 0 on success, 1 if stdin is not a terminal the editor can drive
+ */
+int edit_raw(info_t *info, int on)
+{
+	struct termios raw;
+	char *term;
+
+	if (!on)
+		return (tcsetattr(STDIN_FILENO, TCSADRAIN, &(info->edit.tty)) != 0);
+	term = env_value(info, "TERM");
+	if ((term && !_strcmp(term, "dumb")) ||
+			tcgetattr(STDIN_FILENO, &(info->edit.tty)))
+		return (1);
+	raw = info->edit.tty;
+	raw.c_iflag &= ~(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+	raw.c_lflag &= ~(ECHO | ICANON | IEXTEN | ISIG);
+	raw.c_cc[VMIN] = 1;
+	raw.c_cc[VTIME] = 0;
+	return (tcsetattr(STDIN_FILENO, TCSADRAIN, &raw) != 0);
+}
+
+/**
+ * edit_key - reads a key, turning the escape sequences of the arrow,
+ * Home and End keys into the control keys that do the same
+ * @void: no arguments
+ *
+ * Return: the key, KEY_DELETE for the Delete key, 0 for a sequence the
+ *         editor does not use, or -1 at end of input
+ */
+int edit_key(void)
+{
+	unsigned char c, seq[2];
+
+	if (read(STDIN_FILENO, &c, 1) != 1)
+		return (-1);
+	if (c != 27)
+		return (c);
+	if (read(STDIN_FILENO, seq, 1) != 1 || read(STDIN_FILENO, seq + 1, 1) != 1
+			|| (*seq != '[' && *seq != 'O'))
+		return (0);
+	if (seq[1] >= '0' && seq[1] <= '9')
+	{
+		c = seq[1];
+		while (read(STDIN_FILENO, seq, 1) == 1 && *seq < '@')
+			;
+		if (*seq != '~')
+			return (0);
+		if (c == '1' || c == '7' || c == '4' || c == '8')
+			return (c == '1' || c == '7' ? CTRL_KEY('A') : CTRL_KEY('E'));
+		return (c == '3' ? KEY_DELETE : 0);
+	}
+	switch (seq[1])
+	{
+	case 'A':
+		return (CTRL_KEY('P'));
+	case 'B':
+		return (CTRL_KEY('N'));
+	case 'C':
+		return (CTRL_KEY('F'));
+	case 'D':
+		return (CTRL_KEY('B'));
+	case 'H':
+		return (CTRL_KEY('A'));
+	case 'F':
+		return (CTRL_KEY('E'));
+	}
+	return (0);
+}
+
+/**
+ * edit_width - measures the screen columns text takes, counting the bytes
+ * of a UTF-8 character once
+ * @s: the text
+ * @n: its length
+ *
+ * Return: the number of columns
+ */
+size_t edit_width(char *s, size_t n)
+{
+	size_t w = 0;
+
+	while (n--)
+		w += (*s++ & 0xC0) != 0x80;
+	return (w);
+}
+
+/**
+ * edit_refresh - draws the line again from the column past the prompt,
+ * leaving the cursor where it is in the line
+ * @info: the parameter struct
+ */
+void edit_refresh(info_t *info)
+{
+	editor_t *ed = &(info->edit);
+	size_t n;
+
+	for (n = ed->shown; n; n--)
+		_putchar('\b');
+	ed->line[ed->len] = '\0';
+	_puts(ed->line);
+	_puts("\033[K");
+	for (n = edit_width(ed->line + ed->pos, ed->len - ed->pos); n; n--)
+		_putchar('\b');
+	ed->shown = edit_width(ed->line, ed->pos);
+}
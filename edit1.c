@@ -0,0 +1,167 @@
+#include "shell.h"
+
+/**
+ * edit_insert - inserts text in the line at the cursor, which moves past it
+ * @info: the parameter struct
+ * @s: the text
+ * @n: its length
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_insert(info_t *info, char *s, size_t n)
+{
+	editor_t *ed = &(info->edit);
+	size_t size = (ed->len + n) * 2 + 80;
+	char *line;
+
+	if (ed->len + n + 2 > ed->size)
+	{
+		line = _realloc(ed->line, ed->size, size);
+		if (!line)
+			return (1);
+		ed->line = line;
+		ed->size = size;
+	}
+	memmove(ed->line + ed->pos + n, ed->line + ed->pos, ed->len - ed->pos);
+	memcpy(ed->line + ed->pos, s, n);
+	ed->pos += n;
+	ed->len += n;
+	return (0);
+}
+
+/**
+ * edit_delete - deletes part of the line, leaving the cursor where it was
+ * @info: the parameter struct
+ * @from: the offset of the first byte to delete
+ * @to: the offset past the last one
+ */
+void edit_delete(info_t *info, size_t from, size_t to)
+{
+	editor_t *ed = &(info->edit);
+
+	memmove(ed->line + from, ed->line + to, ed->len - to);
+	ed->len -= to - from;
+	ed->pos = from;
+}
+
+/**
+ * edit_move - moves the cursor for a key that moves it or deletes text:
+ * Ctrl-A / Home and Ctrl-U go to the start of the line, Ctrl-E / End and
+ * Ctrl-K to its end, Ctrl-B / Left and Backspace back a character, Ctrl-F
+ * / Right, Ctrl-D and Delete forward a character and Ctrl-W back a word
+ * @info: the parameter struct
+ * @c: the key, see edit_key()
+ */
+void edit_move(info_t *info, int c)
+{
+	editor_t *ed = &(info->edit);
+
+	if (c == CTRL_KEY('A') || c == CTRL_KEY('U'))
+		ed->pos = 0;
+	else if (c == CTRL_KEY('E') || c == CTRL_KEY('K'))
+		ed->pos = ed->len;
+	else if (c == CTRL_KEY('B') || c == CTRL_KEY('H') || c == 127)
+		while (ed->pos && (ed->line[--ed->pos] & 0xC0) == 0x80)
+			;
+	else if (c == CTRL_KEY('F') || c == CTRL_KEY('D') || c == KEY_DELETE)
+		while (ed->pos < ed->len && (ed->line[++ed->pos] & 0xC0) == 0x80)
+			;
+	else if (c == CTRL_KEY('W'))
+	{
+		while (ed->pos && ed->line[ed->pos - 1] == ' ')
+			ed->pos--;
+		while (ed->pos && ed->line[ed->pos - 1] != ' ')
+			ed->pos--;
+	}
+}
+
+/**
+ * edit_do - carries out a key other than Enter: the keys of edit_move(),
+ * of which Backspace, Ctrl-D, Delete, Ctrl-W, Ctrl-U and Ctrl-K delete
+ * what the cursor moved over, Ctrl-P / Up and Ctrl-N / Down recall
+ * history, Tab completes and Ctrl-L clears the screen; other characters
+ * are inserted
+ * @info: the parameter struct
+ * @c: the key, see edit_key()
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_do(info_t *info, int c)
+{
+	editor_t *ed = &(info->edit);
+	size_t p = ed->pos;
+	char ch = c;
+
+	edit_move(info, c);
+	if (c == CTRL_KEY('U') || c == CTRL_KEY('H') || c == 127 ||
+			c == CTRL_KEY('W'))
+		edit_delete(info, ed->pos, p);
+	else if (c == CTRL_KEY('K') || c == CTRL_KEY('D') || c == KEY_DELETE)
+		edit_delete(info, p, ed->pos);
+	if (c == CTRL_KEY('P') || c == CTRL_KEY('N'))
+		return (edit_recall(info, c == CTRL_KEY('P') ? ed->hist + 1 :
+					ed->hist - 1));
+	if (c == '\t')
+		return (edit_complete(info));
+	if (c == CTRL_KEY('L'))
+	{
+		_puts("\033[H\033[2J");
+		_puts(ed->prompt ? ed->prompt : "");
+		ed->shown = 0;
+	}
+	if ((c >= ' ' && c < 127) || (c > 127 && c < 256))
+		return (edit_insert(info, &ch, 1));
+	return (0);
+}
+
+/**
+ * edit_line - reads a line from the terminal through the line editor;
+ * Ctrl-C drops the line, Ctrl-D on an empty line ends input and Ctrl-R
+ * searches the history, see edit_search()
+ * @info: the parameter struct
+ * @ptr: receives the line, which stays valid until the next call
+ *
+ * Return: the length of the line, newline included, -1 at end of input,
+ *         or -2 if stdin is not a terminal the editor can drive
+ */
+ssize_t edit_line(info_t *info, char **ptr)
+{
+	editor_t *ed = &(info->edit);
+	int c;
+
+	if (edit_raw(info, 1))
+		return (-2);
+	ed->len = ed->pos = ed->shown = ed->hist = 0;
+	for (c = edit_insert(info, "", 0) ? -1 : 0; c != -1; )
+	{
+		_putchar(BUF_FLUSH);
+		c = edit_key();
+		if (c == CTRL_KEY('R'))
+			c = edit_search(info);
+		if (c == '\r' || c == '\n' || (c == CTRL_KEY('D') && !ed->len))
+			break;
+		if (c == CTRL_KEY('C'))
+		{
+			ed->pos = ed->len;
+			edit_refresh(info);
+			_puts("^C");
+			ed->len = ed->pos = ed->shown = 0;
+			break;
+		}
+		if (c == -1 || edit_do(info, c))
+			c = -1;
+		else
+			edit_refresh(info);
+	}
+	ed->pos = ed->len;
+	edit_refresh(info);
+	if (c == -1 || c == CTRL_KEY('D'))
+		return (_putchar(BUF_FLUSH), edit_raw(info, 0), -1);
+	_putchar('\n');
+	_putchar(BUF_FLUSH);
+	edit_raw(info, 0);
+	ed->line[ed->len++] = '\n';
+	ed->line[ed->len] = '\0';
+	*ptr = ed->line;
+	return (ed->len);
+}
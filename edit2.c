@@ -0,0 +1,177 @@
+#include "shell.h"
+
+/**
+ * edit_recall - replaces the line with a history entry, keeping the line
+ * being typed to come back to it
+ * @info: the parameter struct
+ * @back: how many entries back to go, 0 for the line being typed
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_recall(info_t *info, int back)
+{
+	editor_t *ed = &(info->edit);
+	size_t n = hist_count(&(info->history)), len;
+	char *text;
+
+	if (back < 0 || (size_t)back > n)
+		return (0);
+	if (!ed->hist)
+	{
+		free(ed->draft);
+		ed->draft = malloc(ed->len + 1);
+		if (!ed->draft)
+			return (1);
+		memcpy(ed->draft, ed->line, ed->len);
+		ed->draft[ed->len] = '\0';
+	}
+	if (back)
+		text = hist_entry(&(info->history), n - back, &len);
+	else
+		text = ed->draft, len = _strlen(text);
+	ed->hist = back;
+	ed->len = ed->pos = 0;
+	return (edit_insert(info, text, len));
+}
+
+/**
+ * edit_list - lists the completions of the word at the cursor, at most
+ * EDIT_LIST_MAX of them, then prints the prompt for the line to be drawn
+ * again after it
+ * @info: the parameter struct
+ * @names: the completions
+ * @count: the number of them
+ */
+void edit_list(info_t *info, char **names, size_t count)
+{
+	size_t i;
+
+	_putchar('\n');
+	for (i = 0; i < count && i < EDIT_LIST_MAX; i++)
+	{
+		_puts(names[i]);
+		_puts("  ");
+	}
+	if (count > EDIT_LIST_MAX)
+	{
+		_puts("(");
+		_puts(convert_number(count - EDIT_LIST_MAX, 10, 0));
+		_puts(" more)");
+	}
+	_putchar('\n');
+	_puts(info->edit.prompt ? info->edit.prompt : "");
+	info->edit.shown = 0;
+}
+
+/**
+ * edit_matches - completes the word at the cursor from the names it is a
+ * prefix of: as far as they all agree, then with a space, or a '/' for a
+ * directory, if there is only one, or by listing them if there are more
+ * and the word cannot be made longer
+ * @info: the parameter struct
+ * @names: the names, sorted
+ * @count: the number of them
+ * @typed: the length of the part of the word they start with
+ * @dir: the directory the names are in, NULL for commands
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_matches(info_t *info, char **names, size_t count, size_t typed,
+		char *dir)
+{
+	size_t common = count ? _strlen(names[0]) : 0, i, k;
+	char path[PATH_MAX];
+	struct stat st;
+
+	if (!count)
+		return (0);
+	for (i = 1; i < count; i++)
+	{
+		for (k = 0; k < common && names[0][k] == names[i][k]; k++)
+			;
+		common = k;
+	}
+	if (common > typed && edit_insert(info, names[0] + typed, common - typed))
+		return (1);
+	if (count > 1)
+	{
+		if (common == typed)
+			edit_list(info, names, count);
+		return (0);
+	}
+	if (dir && _strlen(dir) + common < PATH_MAX)
+	{
+		_strcpy(path, dir);
+		_strcat(path, names[0]);
+		if (!stat(path, &st) && S_ISDIR(st.st_mode))
+			return (edit_insert(info, "/", 1));
+	}
+	return (edit_insert(info, " ", 1));
+}
+
+/**
+ * edit_files - completes the word at the cursor as a path, from the
+ * names in its directory, hidden ones only if the word asks for them
+ * @info: the parameter struct
+ * @start: the offset of the word in the line
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_files(info_t *info, size_t start)
+{
+	editor_t *ed = &(info->edit);
+	char *word = ed->line + start, **names;
+	size_t n = ed->pos - start, base = 0, i, count = 0;
+	dircache_t d;
+
+	for (i = 0; i < n; i++)
+		if (word[i] == '/')
+			base = i + 1;
+	d.path = arena_copy(&(info->arena), word, base);
+	if (!d.path || dir_read(info, &d))
+		return (1);
+	names = arena_alloc(&(info->arena), sizeof(char *) * (d.count + 1));
+	if (!names)
+		return (1);
+	for (i = 0; i < d.count; i++)
+		if (!strncmp(d.names[i], word + base, n - base) &&
+				(*d.names[i] != '.' || (n > base && word[base] == '.')))
+			names[count++] = d.names[i];
+	qsort(names, count, sizeof(char *), glob_cmp);
+	return (edit_matches(info, names, count, n - base, d.path));
+}
+
+/**
+ * edit_complete - completes the word before the cursor, from the
+ * executables on PATH if it is a command name, or as a path otherwise
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int edit_complete(info_t *info)
+{
+	editor_t *ed = &(info->edit);
+	size_t start = ed->pos, i, count;
+	arena_mark_t mark;
+	int r;
+
+	while (start && !_strchr(" \t;|&<>()", ed->line[start - 1]))
+		start--;
+	i = start;
+	while (i && (ed->line[i - 1] == ' ' || ed->line[i - 1] == '\t'))
+		i--;
+	if (!memchr(ed->line + start, '/', ed->pos - start) &&
+			(!i || _strchr(";|&(", ed->line[i - 1])))
+	{
+		if (index_build(info))
+			return (1);
+		i = index_find(&(ed->index), ed->line + start, ed->pos - start,
+				&count);
+		return (edit_matches(info, ed->index.sorted + i, count,
+					ed->pos - start, NULL));
+	}
+	mark = arena_mark(&(info->arena));
+	r = edit_files(info, start);
+	arena_release(&(info->arena), mark);
+	return (r);
+}
@@ -0,0 +1,83 @@
+#include "shell.h"
+
+/**
+ * edit_found - draws a history search in place of the line: the pattern,
+ * then the entry found with the cursor on the match
+ * @info: the parameter struct
+ * @pat: the pattern
+ * @n: its length
+ * @found: the position of the entry, or -1 if none was found yet
+ * @failing: on if the pattern is in no entry older than the one drawn
+ */
+void edit_found(info_t *info, char *pat, size_t n, long found, int failing)
+{
+	char *text = "", *match;
+	size_t len = 0, k;
+
+	if (found >= 0)
+		text = hist_entry(&(info->history), found, &len);
+	_putchar('\r');
+	_puts(failing ? "(failing reverse-i-search)`" : "(reverse-i-search)`");
+	for (k = 0; k < n; k++)
+		_putchar(pat[k]);
+	_puts("': ");
+	for (k = 0; k < len; k++)
+		_putchar(text[k]);
+	_puts("\033[K");
+	match = memmem(text, len, pat, n);
+	for (k = match ? edit_width(match, text + len - match) : 0; k; k--)
+		_putchar('\b');
+}
+
+/**
+ * edit_search - searches the history back for what is typed, for Ctrl-R:
+ * each character narrows the search from the entry found, Ctrl-R again
+ * goes on to an older entry and Backspace starts over from the newest.
+ * Ctrl-G leaves the line as it was; any other key takes the entry found
+ * into the line, the cursor on the match, and is then carried out
+ * @info: the parameter struct
+ *
+ * Return: the key that ended the search, 0 for Ctrl-G, or -1 at end of
+ *         input or on malloc failure
+ */
+int edit_search(info_t *info)
+{
+	size_t n = 0, count = hist_count(&(info->history)), from;
+	long found = -1, at;
+	char pat[EDIT_SEARCH_MAX], *match;
+	int c, failing = 0;
+
+	for (;;)
+	{
+		edit_found(info, pat, n, found, failing);
+		_putchar(BUF_FLUSH);
+		c = edit_key();
+		if (c == CTRL_KEY('H') || c == 127)
+		{
+			n -= n > 0;
+			found = -1;
+		}
+		else if ((c >= ' ' && c < 127) || (c > 127 && c < 256))
+		{
+			if (n < EDIT_SEARCH_MAX)
+				pat[n++] = c;
+		}
+		else if (c != CTRL_KEY('R'))
+			break;
+		from = found < 0 ? count : (size_t)found + (c != CTRL_KEY('R'));
+		at = n ? hist_find(&(info->history), pat, n, from) : -1;
+		failing = n && at < 0;
+		found = at >= 0 || !n ? at : found;
+	}
+	if (c != CTRL_KEY('G') && c != CTRL_KEY('C') && found >= 0)
+	{
+		if (edit_recall(info, count - found))
+			return (-1);
+		match = memmem(info->edit.line, info->edit.len, pat, n);
+		info->edit.pos = match ? (size_t)(match - info->edit.line) : 0;
+	}
+	_putchar('\r');
+	_puts(info->edit.prompt ? info->edit.prompt : "");
+	info->edit.shown = 0;
+	return (c == CTRL_KEY('G') ? 0 : c);
+}
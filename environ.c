@@ -8,7 +8,13 @@
  */
 int _myenv(info_t *info)
 {
-	print_list_str(info->env);
+	size_t i;
+
+	for (i = 0; i < info->env.count; i++)
+	{
+		_puts(info->env.envp[i]);
+		_puts("\n");
+	}
 	return (0);
 }
 
@@ -22,17 +28,17 @@ int _myenv(info_t *info)
  */
 char *_getenv(info_t *info, const char *name)
 {
-	list_t *node = info->env;
+	size_t len = 0;
+	long slot, insert;
 	char *p;
 
-	while (node)
-	{
-		p = starts_with(node->str, name);
-		if (p && *p)
-			return (p);
-		node = node->next;
-	}
-	return (NULL);
+	while (name[len] && name[len] != '=')
+		len++;
+	slot = env_probe(&(info->env), name, len, &insert);
+	if (slot < 0)
+		return (NULL);
+	p = info->env.envp[info->env.slots[slot]] + len + 1;
+	return (*p ? p : NULL);
 }
 
 /**
@@ -50,8 +56,8 @@ int _mysetenv(info_t *info)
 		return (1);
 	}
 	if (_setenv(info, info->argv[1], info->argv[2]))
-		return (0);
-	return (1);
+		return (1);
+	return (0);
 }
 
 /**
@@ -76,18 +82,23 @@ int _myunsetenv(info_t *info)
 }
 
 /**
- * populate_env_list - populates the environment linked list
+ * populate_env_list - populates the environment table
  * @info: Structure containing potential arguments. Used to maintain
  *         a consistent function prototype.
  * Return: Always 0
  */
 int populate_env_list(info_t *info)
 {
-	list_t *node = NULL;
 	size_t i;
+	char *entry;
 
 	for (i = 0; environ[i]; i++)
-		add_node_end(&node, environ[i], 0);
-	info->env = node;
+	{
+		if (!_strchr(environ[i], '='))
+			continue;
+		entry = _strdup(environ[i]);
+		if (entry)
+			env_store(&(info->env), entry);
+	}
 	return (0);
 }
@@ -0,0 +1,158 @@
+#include "shell.h"
+
+/**
+ * env_hash - hashes a variable name (FNV-1a)
+ * @name: the name, not necessarily NUL-terminated
+ * @len: the length of the name
+ *
+ * Return: the hash value
+ */
+size_t env_hash(const char *name, size_t len)
+{
+	size_t h = 2166136261u;
+
+	while (len--)
+		h = (h ^ (unsigned char)*name++) * 16777619u;
+	return (h);
+}
+
+/**
+ * env_probe - finds the slot of a variable in the environment table
+ * @map: the environment
+ * @name: the variable name, not necessarily NUL-terminated
+ * @len: the length of the name
+ * @insert: receives the first free slot on the probe path, or -1
+ *
+ * Return: the slot holding the variable, or -1 if it is not set
+ */
+long env_probe(envmap_t *map, const char *name, size_t len, long *insert)
+{
+	size_t i, mask = map->nslots - 1;
+	int idx;
+
+	*insert = -1;
+	if (!map->nslots)
+		return (-1);
+	for (i = env_hash(name, len) & mask; ; i = (i + 1) & mask)
+	{
+		idx = map->slots[i];
+		if (idx == ENV_EMPTY || idx == ENV_DELETED)
+		{
+			if (*insert == -1)
+				*insert = i;
+			if (idx == ENV_EMPTY)
+				return (-1);
+			continue;
+		}
+		if (!strncmp(map->envp[idx], name, len) && map->envp[idx][len] == '=')
+			return (i);
+	}
+}
+
+/**
+ * env_rehash - rebuilds the slot table from envp, dropping tombstones
+ * @map: the environment
+ * @nslots: the new table size, a power of two
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int env_rehash(envmap_t *map, size_t nslots)
+{
+	int *slots;
+	size_t i;
+	long insert;
+
+	slots = malloc(sizeof(int) * nslots);
+	if (!slots)
+		return (1);
+	for (i = 0; i < nslots; i++)
+		slots[i] = ENV_EMPTY;
+	free(map->slots);
+	map->slots = slots;
+	map->nslots = nslots;
+	for (i = 0; i < map->count; i++)
+	{
+		env_probe(map, map->envp[i], _strchr(map->envp[i], '=') -
+				map->envp[i], &insert);
+		map->slots[insert] = i;
+	}
+	map->used = map->count;
+	return (0);
+}
+
+/**
+ * env_store - sets a variable from a malloc'ed "NAME=value" string,
+ * updating envp in place so it is always ready for execve()
+ * @map: the environment
+ * @entry: the "NAME=value" string, owned by the environment afterwards
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int env_store(envmap_t *map, char *entry)
+{
+	size_t len = _strchr(entry, '=') - entry;
+	long slot, insert;
+	char **envp;
+
+	if ((map->used + 1) * 4 >= map->nslots * 3 && env_rehash(map,
+				map->count * 2 < map->nslots ? map->nslots :
+				(map->nslots ? map->nslots * 2 : ENV_MIN_SLOTS)))
+		return (free(entry), 1);
+	slot = env_probe(map, entry, len, &insert);
+	if (slot >= 0)
+	{
+		free(map->envp[map->slots[slot]]);
+		map->envp[map->slots[slot]] = entry;
+		env_forget(map, map->slots[slot]);
+		return (0);
+	}
+	if (map->count + 1 >= map->cap)
+	{
+		envp = _realloc(map->envp, sizeof(char *) * map->cap,
+				sizeof(char *) * (map->cap ? map->cap * 2 : ENV_MIN_SLOTS));
+		if (!envp)
+			return (free(entry), 1);
+		map->envp = envp;
+		map->cap = map->cap ? map->cap * 2 : ENV_MIN_SLOTS;
+	}
+	env_forget(map, map->count);
+	map->envp[map->count++] = entry;
+	map->envp[map->count] = NULL;
+	map->used += map->slots[insert] == ENV_EMPTY;
+	map->slots[insert] = map->count - 1;
+	return (0);
+}
+
+/**
+ * env_remove - unsets a variable, moving the last envp entry into the
+ * hole so envp stays contiguous
+ * @map: the environment
+ * @name: the variable name
+ *
+ * Return: 1 if the variable was set, 0 otherwise
+ */
+int env_remove(envmap_t *map, char *name)
+{
+	long slot, moved, insert;
+	int idx;
+
+	slot = env_probe(map, name, _strlen(name), &insert);
+	if (slot < 0)
+		return (0);
+	idx = map->slots[slot];
+	free(map->envp[idx]);
+	map->slots[slot] = ENV_DELETED;
+	if (idx != (int)--map->count)
+	{
+		map->envp[idx] = map->envp[map->count];
+		moved = env_probe(map, map->envp[idx], _strchr(map->envp[idx], '=')
+				- map->envp[idx], &insert);
+		map->slots[moved] = idx;
+		if (map->count < map->numcap)
+			map->nums[idx] = map->nums[map->count];
+		else
+			env_forget(map, idx);
+	}
+	map->envp[map->count] = NULL;
+	return (1);
+}
@@ -0,0 +1,109 @@
+#include "shell.h"
+
+/**
+ * env_cache - makes room in the integer cache for every envp entry,
+ * growing it to the length of envp the first time a value is cached
+ * after envp grew
+ * @map: the environment
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int env_cache(envmap_t *map)
+{
+	numcache_t *nums;
+	size_t i;
+
+	if (map->numcap >= map->cap)
+		return (0);
+	nums = _realloc(map->nums, sizeof(numcache_t) * map->numcap,
+			sizeof(numcache_t) * map->cap);
+	if (!nums)
+		return (1);
+	for (i = map->numcap; i < map->cap; i++)
+		nums[i].valid = 0;
+	map->nums = nums;
+	map->numcap = map->cap;
+	return (0);
+}
+
+/**
+ * env_forget - drops the cached integer of an envp entry whose text changed
+ * @map: the environment
+ * @idx: the index of the entry in envp
+ */
+void env_forget(envmap_t *map, size_t idx)
+{
+	if (idx < map->numcap)
+		map->nums[idx].valid = 0;
+}
+
+/**
+ * arith_get - gives the integer value of a variable, parsing its text only
+ * if it changed since it was last parsed or assigned by arithmetic
+ * @info: the parameter struct
+ * @name: the name, not NUL-terminated
+ * @n: its length
+ * @value: receives the value, 0 if the variable is unset or empty
+ *
+ * Return: 0 on success, 1 if the text is not an integer
+ */
+int arith_get(info_t *info, char *name, size_t n, long *value)
+{
+	envmap_t *map = &(info->env);
+	long slot, insert;
+	char *s, *end;
+	int idx;
+
+	*value = 0;
+	slot = env_probe(map, name, n, &insert);
+	if (slot < 0)
+		return (0);
+	idx = map->slots[slot];
+	if ((size_t)idx < map->numcap && map->nums[idx].valid)
+		return (*value = map->nums[idx].value, 0);
+	s = map->envp[idx] + n + 1;
+	if (!*s)
+		return (0);
+	errno = 0;
+	*value = strtol(s, &end, 0);
+	if (*end || errno)
+		return (1);
+	if (!env_cache(map))
+	{
+		map->nums[idx].value = *value;
+		map->nums[idx].valid = 1;
+	}
+	return (0);
+}
+
+/**
+ * arith_set - assigns an integer to a variable, caching it so the next
+ * arithmetic use of the variable does not parse it back from the text
+ * @info: the parameter struct
+ * @name: the name, not NUL-terminated
+ * @n: its length
+ * @value: the value
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int arith_set(info_t *info, char *name, size_t n, long value)
+{
+	envmap_t *map = &(info->env);
+	char *num = convert_number(value, 10, 0), *entry;
+	long slot, insert;
+
+	entry = malloc(n + _strlen(num) + 2);
+	if (!entry)
+		return (1);
+	memcpy(entry, name, n);
+	entry[n] = '=';
+	_strcpy(entry + n + 1, num);
+	if (n == 4 && !strncmp(name, "PATH", 4))
+		hash_clear(info);
+	if (env_store(map, entry) || env_cache(map))
+		return (1);
+	slot = env_probe(map, name, n, &insert);
+	map->nums[map->slots[slot]].value = value;
+	map->nums[map->slots[slot]].valid = 1;
+	return (0);
+}
@@ -83,3 +83,35 @@ int _putsfd(char *str, int fd)
 	}
 	return (i);
 }
+
+/**
+ * print_syntax_error - reports an unexpected token, as sh does
+ * @info: the parameter & return info struct
+ * @token: the offending token
+ *
+ * Return: the syntax error status, 2
+ */
+int print_syntax_error(info_t *info, char *token)
+{
+	_eputs(info->fname);
+	_eputs(": ");
+	print_d(info->line_count, STDERR_FILENO);
+	_eputs(": Syntax error: \"");
+	_eputs(token);
+	_eputs("\" unexpected\n");
+	return (info->status = 2);
+}
+
+/**
+ * shell_error - after an error has been reported that POSIX makes fatal
+ * to a script, such as a bad expansion, abandons the rest of the command
+ * line: a script then exits, an interactive shell shows the prompt
+ * @info: the parameter & return info struct
+ *
+ * Return: the status, 2
+ */
+int shell_error(info_t *info)
+{
+	info->skip = SKIP_ERROR;
+	return (info->status = 2);
+}
@@ -103,7 +103,7 @@ char *convert_number(long int num, int base, int flags)
 
 	if (!(flags & CONVERT_UNSIGNED) && num < 0)
 	{
-		n = -num;
+		n = -(unsigned long)num;
 		sign = '-';
 
 	}
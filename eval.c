@@ -0,0 +1,164 @@
+#include "shell.h"
+
+/**
+ * set_command - expands a command node into info->argv and info->redirs,
+ * the form the builtins and launchers take a command in, and carries
+ * out the assignments in front of it
+ * @info: the parameter struct
+ * @node: the NODE_CMD node, left as it was so it can run again
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int set_command(info_t *info, node_t *node)
+{
+	char **words = node->words, **argv;
+	int n = 0, count, ret;
+
+	info->line_count = node->line;
+	info->subst_status = 0;
+	while (n < node->nwords && is_assignment(words[n]))
+		n++;
+	if (n == node->nwords)
+		ret = set_argv(info, words, 0);
+	else
+	{
+		count = node->nwords - n;
+		argv = alias_expand(info, words + n, &count);
+		ret = !argv || set_argv(info, argv, count);
+	}
+	if (!ret)
+		ret = set_assigns(info, words, n, *info->argv[0] != '\0');
+	return (ret || copy_redirs(info, node->redirs, &(info->redirs)));
+}
+
+/**
+ * eval_command - runs a simple command in the foreground, builtins
+ * in the shell itself
+ * @info: the parameter struct
+ * @node: the NODE_CMD node
+ *
+ * Return: -2 if the command was exit, 0 otherwise
+ */
+int eval_command(info_t *info, node_t *node)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	int ret = 0;
+
+	if (set_command(info, node))
+		info->status = 1;
+	else
+	{
+		ret = findBuiltin(info);
+		if (ret == -1)
+			findCommand(info);
+	}
+	free_info(info, 0);
+	arena_release(&(info->arena), mark);
+	return (ret == -2 ? -2 : 0);
+}
+
+/**
+ * eval_redirected - runs a compound command with its redirections
+ * applied to the shell until it is done, e.g. `while ...; done > log`
+ * @info: the parameter struct
+ * @node: the compound command
+ *
+ * Return: as eval_node()
+ */
+int eval_redirected(info_t *info, node_t *node)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	redir_t *redirs;
+	int ret;
+
+	info->line_count = node->line;
+	if (copy_redirs(info, node->redirs, &(info->redirs)) ||
+			open_redirs(info))
+	{
+		free_redirs(info);
+		arena_release(&(info->arena), mark);
+		return (info->status = 1, 0);
+	}
+	apply_redirs(info, 1);
+	redirs = info->redirs;
+	info->redirs = NULL;
+	ret = eval_tree(info, node);
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	restore_redirs(redirs);
+	info->redirs = redirs;
+	free_redirs(info);
+	arena_release(&(info->arena), mark);
+	return (ret);
+}
+
+/**
+ * eval_node - runs a syntax tree; the tree is not modified, so loop
+ * bodies can run it any number of times
+ * @info: the parameter struct
+ * @node: the root, may be NULL
+ *
+ * Return: -2 if exit was run, 0 otherwise; the status of the last
+ *         command is in info->status, 2 after shell_error()
+ */
+int eval_node(info_t *info, node_t *node)
+{
+	int ret;
+
+	if (!node)
+		return (0);
+	if (node->redirs && node->type != NODE_CMD)
+		ret = eval_redirected(info, node);
+	else
+		ret = eval_tree(info, node);
+	if (info->skip == SKIP_ERROR)
+		info->status = 2;
+	return (ret);
+}
+
+/**
+ * eval_tree - runs a node according to its type
+ * @info: the parameter struct
+ * @node: the node
+ *
+ * Return: as eval_node()
+ */
+int eval_tree(info_t *info, node_t *node)
+{
+	int ret;
+
+	switch (node->type)
+	{
+	case NODE_CMD:
+		return (eval_command(info, node));
+	case NODE_PIPE:
+		return (run_pipeline(info, node, 0), 0);
+	case NODE_BG:
+		return (run_pipeline(info, node->left, 1), 0);
+	case NODE_IF:
+		return (eval_if(info, node));
+	case NODE_WHILE:
+	case NODE_UNTIL:
+		return (eval_loop(info, node));
+	case NODE_FOR:
+		return (eval_for(info, node));
+	case NODE_CASE:
+		return (eval_case(info, node));
+	case NODE_AND:
+	case NODE_OR:
+		ret = eval_node(info, node->left);
+		if (ret || info->skip ||
+				(node->type == NODE_AND) != (info->status == 0))
+			return (ret);
+		return (eval_node(info, node->right));
+	default:
+		for (; node->type == NODE_SEQ; node = node->right)
+		{
+			ret = eval_node(info, node->left);
+			if (ret || info->skip ||
+					(sigint_seen && loop_skip(info)))
+				return (ret);
+		}
+		return (eval_node(info, node));
+	}
+}
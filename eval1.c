@@ -0,0 +1,144 @@
+#include "shell.h"
+
+/**
+ * eval_if - runs an if command: the then part if the condition succeeds,
+ * otherwise the else part, which may be the if of an elif
+ * @info: the parameter struct
+ * @node: the NODE_IF node
+ *
+ * Return: as eval_node()
+ */
+int eval_if(info_t *info, node_t *node)
+{
+	int ret = eval_node(info, node->left);
+
+	if (ret || info->skip)
+		return (ret);
+	if (!info->status)
+		return (eval_node(info, node->right));
+	info->status = 0;
+	return (eval_node(info, node->next));
+}
+
+/**
+ * loop_skip - lets a loop take a pending break or continue; a Ctrl-C
+ * seen since the last check becomes SKIP_INTR, which like SKIP_ERROR
+ * stops every loop
+ * @info: the parameter struct
+ *
+ * Return: 1 if the loop must stop, 0 if it goes on with the next round
+ */
+int loop_skip(info_t *info)
+{
+	int stop;
+
+	if (sigint_seen)
+	{
+		sigint_seen = 0;
+		info->skip = SKIP_INTR;
+		info->status = 130;
+	}
+	if (!info->skip)
+		return (0);
+	if (info->skip >= SKIP_INTR || --info->skip_count > 0)
+		return (1);
+	stop = info->skip == SKIP_BREAK;
+	info->skip = 0;
+	return (stop);
+}
+
+/**
+ * eval_loop - runs a while or until loop
+ * @info: the parameter struct
+ * @node: the NODE_WHILE or NODE_UNTIL node
+ *
+ * Return: as eval_node(); info->status is that of the last body run,
+ *         0 if the body never ran
+ */
+int eval_loop(info_t *info, node_t *node)
+{
+	int ret, status = 0;
+
+	info->loop_depth++;
+	while (1)
+	{
+		ret = eval_node(info, node->left);
+		if (ret || loop_skip(info))
+			break;
+		if ((info->status == 0) != (node->type == NODE_WHILE))
+			break;
+		ret = eval_node(info, node->right);
+		status = info->status;
+		if (ret || loop_skip(info))
+			break;
+	}
+	info->loop_depth--;
+	if (info->skip < SKIP_INTR)
+		info->status = status;
+	return (ret);
+}
+
+/**
+ * eval_for - runs a for loop over its expanded words
+ * @info: the parameter struct
+ * @node: the NODE_FOR node
+ *
+ * Return: as eval_node()
+ */
+int eval_for(info_t *info, node_t *node)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	char **values;
+	int i, ret = 0, status = 0;
+
+	if (expand_fields(info, node->words + 1, node->nwords - 1,
+				EXP_SPLIT | EXP_GLOB, &values) < 0)
+		return (info->status = 1, 0);
+	info->loop_depth++;
+	for (i = 0; values[i] && !ret; i++)
+	{
+		_setenv(info, node->words[0], values[i]);
+		ret = eval_node(info, node->left);
+		status = info->status;
+		if (loop_skip(info))
+			break;
+	}
+	info->loop_depth--;
+	arena_release(&(info->arena), mark);
+	if (info->skip < SKIP_INTR)
+		info->status = status;
+	return (ret);
+}
+
+/**
+ * eval_case - runs the body of the first case item with a pattern
+ * matching the subject
+ * @info: the parameter struct
+ * @node: the NODE_CASE node
+ *
+ * Return: as eval_node()
+ */
+int eval_case(info_t *info, node_t *node)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	node_t *item, *hit = NULL;
+	char *subject, *pattern;
+	int i;
+
+	info->line_count = node->line;
+	subject = expand_word(info, node->words[0], 0);
+	if (!subject)
+		return (info->status = 1, 0);
+	for (item = node->left; item && !hit && !info->skip; item = item->right)
+		for (i = 0; i < item->nwords && !hit && !info->skip; i++)
+		{
+			pattern = expand_word(info, item->words[i], 1);
+			if (pattern && !fnmatch(pattern, subject, 0))
+				hit = item;
+		}
+	arena_release(&(info->arena), mark);
+	if (info->skip)
+		return (0);
+	info->status = 0;
+	return (hit ? eval_node(info, hit->left) : 0);
+}
@@ -0,0 +1,161 @@
+#include "shell.h"
+
+/**
+ * exp_grow - makes room in the expander's buffer, which sits at the top
+ * of the arena and so usually grows in place
+ * @e: the expander
+ * @n: the number of bytes wanted past e->len
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int exp_grow(expand_t *e, size_t n)
+{
+	size_t size = e->size ? e->size : 64;
+	char *buf;
+
+	if (e->len + n <= e->size)
+		return (0);
+	while (size < e->len + n)
+		size *= 2;
+	buf = arena_grow(&(e->info->arena), e->buf, e->size, size);
+	if (!buf)
+		return (1);
+	e->buf = buf;
+	e->size = size;
+	return (0);
+}
+
+/**
+ * exp_put - appends text to the current field as is
+ * @e: the expander
+ * @s: the text
+ * @n: its length
+ * @quoted: on if the text was quoted: the field is then kept even if
+ *          empty, and for EXP_PATTERN or EXP_GLOB *, ?, [ and \ get
+ *          escaped; unquoted, only \ gets escaped, for EXP_GLOB
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int exp_put(expand_t *e, char *s, size_t n, int quoted)
+{
+	char *special = quoted ? "*?[\\" : "\\";
+	size_t i;
+
+	e->keep |= quoted;
+	if (!n)
+		return (0);
+	if (!(e->flags & (quoted ? EXP_PATTERN | EXP_GLOB : EXP_GLOB)))
+	{
+		if (exp_grow(e, n))
+			return (1);
+		memcpy(e->buf + e->len, s, n);
+		e->len += n;
+		return (0);
+	}
+	if (exp_grow(e, n * 2))
+		return (1);
+	for (i = 0; i < n; i++)
+	{
+		if (_strchr(special, s[i]))
+			e->buf[e->len++] = '\\';
+		e->buf[e->len++] = s[i];
+	}
+	return (0);
+}
+
+/**
+ * exp_end - ends the current field, dropping it if it is empty and had
+ * nothing quoted in it
+ * @e: the expander
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int exp_end(expand_t *e)
+{
+	if (e->len == e->start && !e->keep)
+		return (0);
+	if (exp_grow(e, 1))
+		return (1);
+	e->buf[e->len++] = '\0';
+	e->start = e->len;
+	e->keep = 0;
+	e->nfields++;
+	return (0);
+}
+
+/**
+ * exp_value - appends the value of an expansion, split into fields on
+ * IFS when it is unquoted and the expander splits: a field ends at a run
+ * of IFS whitespace, which may hold one other IFS character; only a
+ * field ended by such a character is kept when empty
+ * @e: the expander
+ * @s: the value
+ * @n: its length
+ * @dq: on inside double quotes
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int exp_value(expand_t *e, char *s, size_t n, int dq)
+{
+	char *ifs;
+	size_t i, j;
+	int k;
+
+	if (dq || !(e->flags & EXP_SPLIT))
+		return (exp_put(e, s, n, dq));
+	ifs = env_value(e->info, "IFS");
+	if (!ifs)
+		ifs = " \t\n";
+	for (i = 0; i < n; i = j)
+	{
+		for (j = i; j < n && !_strchr(ifs, s[j]); j++)
+			;
+		if (exp_put(e, s + i, j - i, 0))
+			return (1);
+		if (j == n)
+			break;
+		for (k = 0; j < n && _strchr(ifs, s[j]); j++)
+			if (!_strchr(" \t\n", s[j]) && k++)
+				break;
+		if (k)
+			e->keep = 1;
+		if (exp_end(e))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * expand_fields - expands words into fields: parameters substituted,
+ * unquoted results split, quotes removed, in one pass over each word,
+ * then for EXP_GLOB pathnames expanded
+ * @info: the parameter struct
+ * @words: the words as written
+ * @n: the number of words
+ * @flags: EXP_SPLIT, EXP_PATTERN and EXP_GLOB
+ * @fields: receives the NULL-terminated fields, in the arena
+ *
+ * Return: the number of fields, or -1 on error
+ */
+int expand_fields(info_t *info, char **words, int n, int flags,
+		char ***fields)
+{
+	expand_t e = {NULL, NULL, 0, 0, 0, 0, 0, 0};
+	char *p;
+	int i;
+
+	e.info = info;
+	e.flags = flags;
+	for (i = 0; i < n; i++)
+		if (exp_text(&e, words[i], NULL, 0) || exp_end(&e))
+			return (-1);
+	if (flags & EXP_GLOB)
+		return (glob_fields(info, e.buf, e.nfields, fields));
+	*fields = arena_alloc(&(info->arena), sizeof(char *) * (e.nfields + 1));
+	if (!*fields)
+		return (-1);
+	for (i = 0, p = e.buf; i < e.nfields; i++, p += _strlen(p) + 1)
+		(*fields)[i] = p;
+	(*fields)[i] = NULL;
+	return (e.nfields);
+}
@@ -0,0 +1,168 @@
+#include "shell.h"
+
+/**
+ * exp_text - expands text as written: quotes removed, backslash escapes
+ * applied and parameters substituted, into the current field; "$@" adds
+ * nothing, not even an empty field, as there are no positional parameters;
+ * a quote left open, as an alias value may have it, runs to the end;
+ * under EXP_WORD, unquoted text is split like an expansion
+ * @e: the expander
+ * @s: the text
+ * @end: where the text ends, or NULL to run to the '\0'
+ * @dq: on if the text is inside double quotes
+ *
+ * Return: 0 on success, 1 on error
+ */
+int exp_text(expand_t *e, char *s, char *end, int dq)
+{
+	char *p;
+
+	while (s != end && *s)
+	{
+		if (*s == '\'' && !dq)
+		{
+			for (p = ++s; p != end && *p && *p != '\''; p++)
+				;
+			if (exp_put(e, s, p - s, 1))
+				return (1);
+			s = p != end && *p ? p + 1 : p;
+		}
+		else if (!dq && (starts_with(s, "\"$@\"") ||
+					starts_with(s, "\"${@}\"")))
+			s += s[2] == '@' ? 4 : 6;
+		else if (*s == '"')
+			dq = !dq, e->keep = 1, s++;
+		else if (*s == '\\' && s[1] && (!dq || _strchr("$`\"\\", s[1])))
+		{
+			if (exp_put(e, s + 1, 1, 1))
+				return (1);
+			s += 2;
+		}
+		else if (*s == '$' || *s == '`')
+		{
+			s = exp_param(e, s, dq);
+			if (!s)
+				return (1);
+		}
+		else
+		{
+			for (p = s + 1; p != end && *p && !_strchr("'\"\\$`", *p); p++)
+				;
+			if (e->flags & EXP_WORD ? exp_value(e, s, p - s, dq) :
+					exp_put(e, s, p - s, dq))
+				return (1);
+			s = p;
+		}
+	}
+	return (0);
+}
+
+/**
+ * exp_param - expands $NAME, $? and the other special parameters, a
+ * ${...} form, an arithmetic expansion or a command substitution into
+ * the current field
+ * @e: the expander
+ * @s: the '$', or the '`' of a command substitution
+ * @dq: on inside double quotes
+ *
+ * Return: a pointer past the expansion, or NULL on error
+ */
+char *exp_param(expand_t *e, char *s, int dq)
+{
+	char num[24], *value;
+	size_t n;
+
+	if (s[1] == '{')
+		return (exp_brace(e, s, dq));
+	if (*s == '$' && s[1] == '(' && s[2] == '(')
+		return (exp_arith(e, s, dq));
+	if (*s == '`' || s[1] == '(')
+		return (exp_subst(e, s, dq));
+	n = param_name(s + 1);
+	if (!n)
+		return (exp_put(e, s, 1, dq) ? NULL : s + 1);
+	value = param_value(e->info, s + 1, n, num);
+	if (value && exp_value(e, value, _strlen(value), dq))
+		return (NULL);
+	return (s + 1 + n);
+}
+
+/**
+ * param_name - measures the parameter name at the start of a string
+ * @s: the string, just past the '$'
+ *
+ * Return: the length of the name, 0 if there is none
+ */
+size_t param_name(char *s)
+{
+	size_t n = 0;
+
+	if (char_class[(unsigned char)*s] & CC_DIGIT ||
+			(*s && _strchr("?$!#@*-", *s)))
+		return (1);
+	while (char_class[(unsigned char)s[n]] & CC_NAME)
+		n++;
+	return (n);
+}
+
+/**
+ * param_value - looks up a parameter; the shell has no positional
+ * parameters, so $1 to $9, $@ and $* are unset and $# is 0
+ * @info: the parameter struct
+ * @name: the name, not NUL-terminated
+ * @n: the length of the name
+ * @num: room for a number, at least 24 bytes
+ *
+ * Return: the value, not to be freed, or NULL if it is unset
+ */
+char *param_value(info_t *info, char *name, size_t n, char *num)
+{
+	long slot, insert;
+
+	if (n == 1 && *name == '?')
+		return (_strcpy(num, convert_number(info->status, 10, 0)));
+	if (n == 1 && *name == '$')
+		return (info->pid);
+	if (n == 1 && *name == '!')
+		return (info->last_bg ?
+				_strcpy(num, convert_number(info->last_bg, 10, 0)) : NULL);
+	if (n == 1 && *name == '#')
+		return ("0");
+	if (n == 1 && *name == '0')
+		return (info->fname);
+	if (!(char_class[(unsigned char)*name] & CC_NAME) ||
+			char_class[(unsigned char)*name] & CC_DIGIT)
+		return (NULL);
+	slot = env_probe(&(info->env), name, n, &insert);
+	if (slot < 0)
+		return (NULL);
+	return (info->env.envp[info->env.slots[slot]] + n + 1);
+}
+
+/**
+ * skip_brace - finds the '}' closing a ${ form, skipping quoted text
+ * and nested ${ forms
+ * @s: the text just past the "${"
+ *
+ * Return: a pointer to the '}', or NULL if it is not closed
+ */
+char *skip_brace(char *s)
+{
+	char quote = 0;
+	int depth = 1, qdepth = 0;
+
+	for (; *s; s++)
+	{
+		if (quote == '\'')
+			quote = *s == '\'' ? 0 : quote;
+		else if (*s == '\\' && s[1])
+			s++;
+		else if (*s == '"' || (*s == '\'' && !quote))
+			quote = quote ? 0 : *s, qdepth = depth;
+		else if (*s == '$' && s[1] == '{')
+			depth++, s++;
+		else if (*s == '}' && (!quote || depth > qdepth) && !--depth)
+			return (s);
+	}
+	return (NULL);
+}
@@ -0,0 +1,180 @@
+#include "shell.h"
+
+/**
+ * bad_subst - reports a ${...} form that cannot be expanded
+ * @e: the expander
+ *
+ * Return: NULL, for exp_brace() to return; see shell_error()
+ */
+char *bad_subst(expand_t *e)
+{
+	_eputs(e->info->fname);
+	_eputs(": ");
+	print_d(e->info->line_count, STDERR_FILENO);
+	_eputs(": Bad substitution\n");
+	shell_error(e->info);
+	return (NULL);
+}
+
+/**
+ * exp_temp - expands the word of a ${name op word} form into the buffer
+ * past the current field, for exp_brace() to use and then drop
+ * @e: the expander
+ * @word: the word
+ * @end: the closing '}'
+ * @flags: the flags to expand it with, instead of the expander's
+ *
+ * Return: the offset of the NUL-terminated text in e->buf, or -1
+ */
+long exp_temp(expand_t *e, char *word, char *end, int flags)
+{
+	size_t mark = e->len;
+	int saved = e->flags, keep = e->keep;
+
+	e->flags = flags;
+	if (exp_text(e, word, end, 0) || exp_grow(e, 1))
+		return (-1);
+	e->buf[e->len] = '\0';
+	e->flags = saved;
+	e->keep = keep;
+	e->len = mark;
+	return (mark);
+}
+
+/**
+ * exp_assign - handles ${name=word}: assigns the expanded word
+ * @e: the expander
+ * @name: the name, not NUL-terminated
+ * @n: its length
+ * @word: the word
+ * @end: the closing '}'
+ *
+ * Return: the new value, or NULL on error
+ */
+char *exp_assign(expand_t *e, char *name, size_t n, char *word, char *end)
+{
+	long text = exp_temp(e, word, end, 0);
+	size_t len;
+	char num[24];
+
+	if (text < 0)
+		return (NULL);
+	if (char_class[(unsigned char)*name] & CC_DIGIT ||
+			!(char_class[(unsigned char)*name] & CC_NAME))
+		return (bad_subst(e));
+	len = _strlen(e->buf + text) + 1;
+	if (exp_grow(e, len + n + 1))
+		return (NULL);
+	memcpy(e->buf + e->len + len, name, n);
+	e->buf[e->len + len + n] = '\0';
+	_setenv(e->info, e->buf + e->len + len, e->buf + text);
+	return (param_value(e->info, name, n, num));
+}
+
+/**
+ * trim_param - finds what is left of a value once the shortest or
+ * longest prefix or suffix matching a pattern is removed
+ * @pat: the pattern
+ * @v: a writable copy of the value
+ * @op: '#' for a prefix, '%' for a suffix
+ * @longest: on for ## and %%
+ * @len: receives the length of what is left
+ *
+ * Return: the offset of what is left in v
+ */
+size_t trim_param(char *pat, char *v, int op, int longest, size_t *len)
+{
+	size_t n = _strlen(v), i, k;
+	char saved;
+
+	for (k = 0; k <= n; k++)
+	{
+		if (op == '%')
+		{
+			i = longest ? k : n - k;
+			if (!fnmatch(pat, v + i, 0))
+				return (*len = i, 0);
+			continue;
+		}
+		i = longest ? n - k : k;
+		saved = v[i];
+		v[i] = '\0';
+		if (!fnmatch(pat, v, 0))
+			return (v[i] = saved, *len = n - i, i);
+		v[i] = saved;
+	}
+	return (*len = n, 0);
+}
+
+/**
+ * exp_trim - handles ${name#pattern} and the ##, % and %% forms
+ * @e: the expander
+ * @v: the value
+ * @op: the operator
+ * @end: the closing '}'
+ * @len: the length of v, receives the length of what is left
+ *
+ * Return: what is left of v, or NULL on error
+ */
+char *exp_trim(expand_t *e, char *v, char *op, char *end, size_t *len)
+{
+	int longest = op[1] == *op;
+	long pat = exp_temp(e, op + 1 + longest, end, EXP_PATTERN);
+	char *copy;
+
+	if (pat < 0 || exp_grow(e, _strlen(e->buf + pat) + *len + 2))
+		return (NULL);
+	copy = e->buf + pat + _strlen(e->buf + pat) + 1;
+	_strcpy(copy, v);
+	return (v + trim_param(e->buf + pat, copy, *op, longest, len));
+}
+
+/**
+ * exp_brace - expands ${name}, ${#name}, ${name-word}, ${name=word},
+ * ${name+word}, the forms of them with ':' that also treat an empty
+ * value as unset, and ${name#pattern}, ##, % and %%; the word of the
+ * - and + forms is split when unquoted, as its result would be
+ * @e: the expander
+ * @s: the '$'
+ * @dq: on inside double quotes
+ *
+ * Return: a pointer past the closing '}', or NULL on error
+ */
+char *exp_brace(expand_t *e, char *s, int dq)
+{
+	char num[24], *name = s + 2, *end = skip_brace(s + 2), *op, *v;
+	size_t n, len;
+	int length = 0, c, colon, unset, flags = e->flags;
+
+	if (end && *name == '#' && name + 1 != end)
+		length = 1, name++;
+	n = end ? param_name(name) : 0;
+	op = name + n;
+	colon = end && *op == ':';
+	c = op == end ? 0 : op[colon];
+	if (!n || (length && c) || (c && !_strchr(colon ? "-=+" : "-=+#%", c)))
+		return (bad_subst(e));
+	v = param_value(e->info, name, n, num);
+	if (length)
+		v = convert_number(v ? _strlen(v) : 0, 10, 0);
+	unset = !v || (colon && !*v);
+	if ((c == '-' && unset) || (c == '+' && !unset))
+	{
+		e->flags |= EXP_WORD;
+		c = exp_text(e, op + colon + 1, end, dq);
+		e->flags = flags;
+		return (c ? NULL : end + 1);
+	}
+	if (c == '=' && unset)
+		v = exp_assign(e, name, n, op + colon + 1, end);
+	if (c == '+' || (c == '=' && !v))
+		return (c == '+' ? end + 1 : NULL);
+	len = v ? _strlen(v) : 0;
+	if (v && (c == '#' || c == '%'))
+	{
+		v = exp_trim(e, v, op, end, &len);
+		if (!v)
+			return (NULL);
+	}
+	return (v && exp_value(e, v, len, dq) ? NULL : end + 1);
+}
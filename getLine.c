@@ -1,7 +1,9 @@
 #include "shell.h"
 
+volatile sig_atomic_t sigint_seen;
+
 /**
- * input_buf - Buffers chained commands.
+ * input_buf - Reads the next line of input and records it in history.
  * @info: Parameter struct.
  * @buf: Address of buffer.
  * @len: Address of length variable.
@@ -15,15 +17,25 @@ ssize_t input_buf(info_t *info, char **buf, size_t *len)
 
     if (!*len) /* If nothing left in the buffer, fill it */
     {
-        /*bfree((void **)info->cmd_buf);*/
+        if (interactive(info))
+            signal(SIGINT, sigintHandler);
+        sigint_seen = SIGINT_READING;
+#if USE_GETLINE
         free(*buf);
         *buf = NULL;
-        signal(SIGINT, sigintHandler);
-#if USE_GETLINE
         r = getline(buf, &len_p, stdin);
 #else
-        r = _getline(info, buf, &len_p);
+        /* Lines are slices of the input, script or line editor buffer */
+        if (info->script.data)
+            r = script_line(info, buf);
+        else
+        {
+            r = interactive(info) ? edit_line(info, buf) : -2;
+            if (r == -2) /* No terminal the line editor can drive */
+                r = _getline(info, buf, &len_p);
+        }
 #endif
+        sigint_seen = 0;
         if (r > 0)
         {
             if ((*buf)[r - 1] == '\n')
@@ -31,140 +43,167 @@ ssize_t input_buf(info_t *info, char **buf, size_t *len)
                 (*buf)[r - 1] = '\0'; /* Remove trailing newline */
                 r--;
             }
-            info->linecount_flag = 1;
-            remove_comments(*buf);
-            build_history_list(info, *buf, info->histcount++);
-            /* If (_strchr(*buf, ';')) is this a command chain? */
-            {
-                *len = r;
-                info->cmd_buf = buf;
-            }
+            info->input_line++;
+            if (interactive(info))
+                hist_add(info, *buf, r);
+            *len = r;
         }
     }
     return (r);
 }
 
 /**
- * get_input - Gets a line without the newline character.
+ * get_input - Reads the next line of input for the lexer.
  * @info: Parameter struct.
  *
- * Return: Number of bytes read.
+ * Return: Length of the line, left in info->arg without its newline,
+ * or -1 at end of input.
  */
 ssize_t get_input(info_t *info)
 {
-    static char *buf; /* The ';' command chain buffer */
-    static size_t i, j, len;
-    ssize_t r = 0;
-    char **buf_p = &(info->arg), *p;
+    static char *buf; /* The current line */
+    size_t len = 0;
+    ssize_t r;
 
     _putchar(BUF_FLUSH);
     r = input_buf(info, &buf, &len);
     if (r == -1) /* EOF */
         return (-1);
-    if (len) /* We have commands left in the chain buffer */
-    {
-        j = i; /* Initialize a new iterator to the current buffer position */
-        p = buf + i; /* Get a pointer for return */
+    info->arg = buf;
+    return (r);
+}
 
-        check_chain(info, buf, &j, i, len);
-        while (j < len) /* Iterate to semicolon or end */
-        {
-            if (is_chain(info, buf, &j))
-                break;
-            j++;
-        }
+/**
+ * heredoc_body - Reads the lines of a here-document up to its delimiter
+ * line, or to the end of input, straight from the input.
+ * @info: Parameter struct.
+ * @delim: The delimiter.
+ * @strip: If on, leading tabs are removed from each line, as for <<-.
+ *
+ * Return: The body, each line ending in a newline, in the arena;
+ * NULL on malloc failure.
+ */
+char *heredoc_body(info_t *info, char *delim, int strip)
+{
+    char *body = NULL, *line, *grown;
+    size_t len = 0, size = 0, n;
+    ssize_t r;
 
-        i = j + 1; /* Increment past nulled ';'' */
-        if (i >= len) /* Reached the end of the buffer? */
+    while (1)
+    {
+        show_prompt(info, "> ");
+        r = get_input(info);
+        if (r == -1)
+            break;
+        for (line = info->arg; strip && *line == '\t'; line++)
+            ;
+        if (!_strcmp(line, delim))
+            break;
+        n = r - (line - info->arg);
+        if (len + n + 2 > size)
         {
-            i = len = 0; /* Reset position and length */
-            info->cmd_buf_type = CMD_NORM;
+            grown = arena_grow(&(info->arena), body, size, (len + n) * 2 + 64);
+            if (!grown)
+                return (NULL);
+            body = grown;
+            size = (len + n) * 2 + 64;
         }
-
-        *buf_p = p; /* Pass back a pointer to the current command position */
-        return (_strlen(p)); /* Return the length of the current command */
+        memcpy(body + len, line, n);
+        len += n;
+        body[len++] = '\n';
     }
-
-    *buf_p = buf; /* Not a chain, pass back the buffer from _getline() */
-    return (r); /* Return the length of the buffer from _getline() */
+    if (!body)
+        return (arena_copy(&(info->arena), "", 0));
+    body[len] = '\0';
+    return (body);
 }
 
 /**
- * read_buf - Reads a buffer.
+ * read_buf - Reads more input into the per-info buffer, first moving the
+ * bytes not handed out yet to its start and doubling it when it is full.
  * @info: Parameter struct.
- * @buf: Buffer.
- * @i: Size.
  *
- * Return: r
+ * Return: Number of bytes read, 0 at end of input, -1 on error.
  */
-ssize_t read_buf(info_t *info, char *buf, size_t *i)
+ssize_t read_buf(info_t *info)
 {
-    ssize_t r = 0;
+    reader_t *in = &(info->input);
+    size_t size = in->size ? in->size * 2 : READ_BUF_SIZE;
+    ssize_t r;
+    char *p;
 
-    if (*i)
-        return (0);
-    r = read(info->readfd, buf, READ_BUF_SIZE);
-    if (r >= 0)
-        *i = r;
+    if (in->start)
+    {
+        memmove(in->buf, in->buf + in->start, in->end - in->start);
+        in->end -= in->start;
+        in->start = 0;
+    }
+    if (in->end + 1 >= in->size) /* Keep room for a terminating NUL */
+    {
+        p = _realloc(in->buf, in->size, size);
+        if (!p)
+            return (-1);
+        in->buf = p;
+        in->size = size;
+    }
+    r = read(info->readfd, in->buf + in->end, in->size - in->end - 1);
+    if (r > 0)
+        in->end += r;
     return (r);
 }
 
 /**
- * _getline - Gets the next line of input from STDIN.
+ * _getline - Gets the next line of input, newline included, as a slice
+ * of the per-info buffer that stays valid until the next call.
  * @info: Parameter struct.
- * @ptr: Address of the pointer to the buffer, preallocated or NULL.
- * @length: Size of the preallocated ptr buffer if not NULL.
+ * @ptr: Receives the start of the line.
+ * @length: Receives the length of the line if not NULL.
  *
- * Return: s
+ * Return: Length of the line, -1 at end of input.
  */
 int _getline(info_t *info, char **ptr, size_t *length)
 {
-    static char buf[READ_BUF_SIZE];
-    static size_t i, len;
-    size_t k;
-    ssize_t r = 0, s = 0;
-    char *p = NULL, *new_p = NULL, *c;
-
-    p = *ptr;
-    if (p && length)
-        s = *length;
-    if (i == len)
-        i = len = 0;
+    reader_t *in = &(info->input);
+    size_t scanned = 0, k;
+    char *nl = NULL;
 
-    r = read_buf(info, buf, &len);
-    if (r == -1 || (r == 0 && len == 0))
+    while (1)
+    {
+        if (in->end > in->start + scanned) /* Only scan the new bytes */
+            nl = memchr(in->buf + in->start + scanned, '\n',
+                    in->end - in->start - scanned);
+        if (nl)
+            break;
+        scanned = in->end - in->start;
+        if (read_buf(info) <= 0)
+            break;
+    }
+    if (in->end == in->start)
         return (-1);
-
-    c = _strchr(buf + i, '\n');
-    k = c ? 1 + (unsigned int)(c - buf) : len;
-    new_p = _realloc(p, s, s ? s + k : k + 1);
-    if (!new_p) /* MALLOC FAILURE! */
-        return (p ? free(p), -1 : -1);
-
-    if (s)
-        _strncat(new_p, buf + i, k - i);
-    else
-        _strncpy(new_p, buf + i, k - i + 1);
-
-    s += k - i;
-    i = k;
-    p = new_p;
-
+    k = nl ? (size_t)(nl - (in->buf + in->start)) + 1 : in->end - in->start;
+    *ptr = in->buf + in->start;
+    if (!nl)
+        in->buf[in->end] = '\0'; /* Last line without a newline */
+    in->start += k;
     if (length)
-        *length = s;
-    *ptr = p;
-    return (s);
+        *length = k;
+    return (k);
 }
 
 /**
- * sigintHandler - Blocks Ctrl-C.
+ * sigintHandler - Notes a Ctrl-C for the loops to stop on, see
+ * loop_skip(); while a line is read it only starts a fresh prompt.
  * @sig_num: The signal number.
  *
  * Return: Void.
  */
 void sigintHandler(__attribute__((unused))int sig_num)
 {
-    _puts("\n");
-    _puts("$ ");
-    _putchar(BUF_FLUSH);
+    if (sigint_seen == SIGINT_READING)
+    {
+        write(STDOUT_FILENO, "\n$ ", 3);
+        return;
+    }
+    sigint_seen = 1;
+    write(STDOUT_FILENO, "\n", 1);
 }
@@ -1,20 +1,17 @@
 #include "shell.h"
 
 /**
- * get_environ - Returns a copy of the string array 'environ.'
+ * get_environ - Returns the envp array kept up to date by _setenv() and
+ *          _unsetenv(), ready to be handed to execve() without copying.
  * @info: Structure containing potential arguments. Used to maintain
  *          a consistent function prototype.
- * Return: Always 0
+ * Return: The NULL-terminated environment array.
  */
 char **get_environ(info_t *info)
 {
-    if (!info->environ || info->env_changed)
-    {
-        info->environ = list_to_strings(info->env);
-        info->env_changed = 0;
-    }
+    static char *empty[] = {NULL};
 
-    return (info->environ);
+    return (info->env.envp ? info->env.envp : empty);
 }
 
 /**
@@ -26,27 +23,11 @@ char **get_environ(info_t *info)
  */
 int _unsetenv(info_t *info, char *var)
 {
-    list_t *node = info->env;
-    size_t i = 0;
-    char *p;
-
-    if (!node || !var)
+    if (!var)
         return (0);
-
-    while (node)
-    {
-        p = starts_with(node->str, var);
-        if (p && *p == '=')
-        {
-            info->env_changed = delete_node_at_index(&(info->env), i);
-            i = 0;
-            node = info->env;
-            continue;
-        }
-        node = node->next;
-        i++;
-    }
-    return (info->env_changed);
+    if (!_strcmp(var, "PATH"))
+        hash_clear(info);
+    return (env_remove(&(info->env), var));
 }
 
 /**
@@ -55,16 +36,16 @@ int _unsetenv(info_t *info, char *var)
  *        a consistent function prototype.
  * @var: The environment variable to be set or modified.
  * @value: The value of the environment variable.
- * Return: Always 0
+ * Return: 0 on success, 1 on failure
  */
 int _setenv(info_t *info, char *var, char *value)
 {
     char *buf = NULL;
-    list_t *node;
-    char *p;
 
     if (!var || !value)
         return (0);
+    if (!_strcmp(var, "PATH"))
+        hash_clear(info);
 
     buf = malloc(_strlen(var) + _strlen(value) + 2);
     if (!buf)
@@ -72,21 +53,36 @@ int _setenv(info_t *info, char *var, char *value)
     _strcpy(buf, var);
     _strcat(buf, "=");
     _strcat(buf, value);
-    node = info->env;
-    while (node)
-    {
-        p = starts_with(node->str, var);
-        if (p && *p == '=')
-        {
-            free(node->str);
-            node->str = buf;
-            info->env_changed = 1;
-            return (0);
-        }
-        node = node->next;
-    }
-    add_node_end(&(info->env), buf, 0);
-    free(buf);
-    info->env_changed = 1;
-    return (0);
+    return (env_store(&(info->env), buf));
+}
+
+/**
+ * env_value - Gets the value of a variable, even if it is empty.
+ * @info: Structure containing potential arguments. Used to maintain
+ *        a consistent function prototype.
+ * @name: The variable name, without '='.
+ * Return: The value, or NULL if the variable is not set.
+ */
+char *env_value(info_t *info, char *name)
+{
+    long slot, insert;
+
+    slot = env_probe(&(info->env), name, _strlen(name), &insert);
+    if (slot < 0)
+        return (NULL);
+    return (info->env.envp[info->env.slots[slot]] + _strlen(name) + 1);
+}
+
+/**
+ * free_env - Frees the environment table.
+ * @info: Structure containing potential arguments. Used to maintain
+ *        a consistent function prototype.
+ * Return: void
+ */
+void free_env(info_t *info)
+{
+    ffree(info->env.envp);
+    free(info->env.slots);
+    free(info->env.nums);
+    _memset((void *)&(info->env), 0, sizeof(envmap_t));
 }
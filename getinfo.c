@@ -12,37 +12,6 @@ void clear_info(info_t *info)
     info->argc = 0;
 }
 
-/**
- * set_info - Initializes the info_t struct.
- * @info: The address of the struct.
- * @av: The argument vector.
- */
-void set_info(info_t *info, char **av)
-{
-    int i = 0;
-
-    info->fname = av[0];
-    if (info->arg)
-    {
-        info->argv = strtow(info->arg, " \t");
-        if (!info->argv)
-        {
-            info->argv = malloc(sizeof(char *) * 2);
-            if (info->argv)
-            {
-                info->argv[0] = _strdup(info->arg);
-                info->argv[1] = NULL;
-            }
-        }
-        for (i = 0; info->argv && info->argv[i]; i++)
-            ;
-        info->argc = i;
-
-        replace_alias(info);
-        replace_vars(info);
-    }
-}
-
 /**
  * free_info - Frees fields of the info_t struct.
  * @info: The address of the struct.
@@ -50,22 +19,24 @@ void set_info(info_t *info, char **av)
  */
 void free_info(info_t *info, int all)
 {
-    ffree(info->argv);
+    restore_assigns(info);
     info->argv = NULL;
     info->path = NULL;
+    free_redirs(info);
     if (all)
     {
-        if (!info->cmd_buf)
-            free(info->arg);
-        if (info->env)
-            free_list(&(info->env));
-        if (info->history)
-            free_list(&(info->history));
-        if (info->alias)
-            free_list(&(info->alias));
-        ffree(info->environ);
-        info->environ = NULL;
-        bfree((void **)info->cmd_buf);
+        free_env(info);
+        hist_free(&(info->history));
+        alias_free(info);
+        hash_clear(info);
+        while (info->jobs)
+            remove_job(info, info->jobs);
+        free(info->input.buf);
+        free(info->edit.line);
+        free(info->edit.draft);
+        index_free(&(info->edit.index));
+        arena_free(&(info->arena));
+        script_close(info);
         if (info->readfd > 2)
             close(info->readfd);
         _putchar(BUF_FLUSH);
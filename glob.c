@@ -0,0 +1,165 @@
+#include "shell.h"
+
+/**
+ * glob_push - appends a field to the result of pathname expansion
+ * @g: the globber
+ * @s: the field, NULL if it could not be allocated
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int glob_push(pathglob_t *g, char *s)
+{
+	size_t size = g->size ? g->size * 2 : 16;
+	char **fields;
+
+	if (!s)
+		return (1);
+	if (g->nfields == g->size)
+	{
+		fields = arena_grow(&(g->info->arena), g->fields,
+				sizeof(char *) * g->size, sizeof(char *) * size);
+		if (!fields)
+			return (1);
+		g->fields = fields;
+		g->size = size;
+	}
+	g->fields[g->nfields++] = s;
+	return (0);
+}
+
+/**
+ * glob_cmp - orders two fields for qsort()
+ * @a: the first field
+ * @b: the second field
+ *
+ * Return: as strcmp()
+ */
+int glob_cmp(const void *a, const void *b)
+{
+	return (strcmp(*(char * const *)a, *(char * const *)b));
+}
+
+/**
+ * glob_dir - matches one component of a pattern against the names in
+ * the directory g->path names, going on with the rest of the pattern
+ * for each name that matches
+ * @g: the globber
+ * @len: the length of g->path
+ * @comp: the component, followed by the rest of the pattern
+ * @n: the length of the component
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int glob_dir(pathglob_t *g, size_t len, char *comp, size_t n)
+{
+	char *pat, *suffix, *name;
+	dircache_t *d;
+	size_t i, k, plen;
+
+	g->path[len] = '\0';
+	d = dir_cache(g, g->path);
+	pat = arena_copy(&(g->info->arena), comp, n);
+	if (!d || !pat)
+		return (1);
+	plen = glob_prefix(pat, &suffix);
+	for (i = 0; i < d->count; i++)
+	{
+		name = d->names[i];
+		if ((*name == '.' && *pat != '.') ||
+				!glob_name(pat, plen, suffix, name))
+			continue;
+		k = _strlen(name);
+		if (len + k + 1 >= PATH_MAX)
+			continue;
+		memcpy(g->path + len, name, k);
+		if (comp[n] && glob_walk(g, len + k, comp + n))
+			return (1);
+		if (!comp[n] && glob_push(g, arena_copy(&(g->info->arena),
+						g->path, len + k)))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * glob_walk - expands the rest of a pattern below the path built so far,
+ * reading a directory only for components with pattern characters
+ * @g: the globber
+ * @len: the length of g->path
+ * @pat: the rest of the pattern
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int glob_walk(pathglob_t *g, size_t len, char *pat)
+{
+	struct stat st;
+	size_t n;
+
+	for (; *pat == '/'; pat++)
+	{
+		if (len + 1 >= PATH_MAX)
+			return (0);
+		g->path[len++] = '/';
+	}
+	if (!*pat)
+	{
+		g->path[len] = '\0';
+		if (lstat(g->path, &st))
+			return (0);
+		return (glob_push(g, arena_copy(&(g->info->arena), g->path, len)));
+	}
+	for (n = 0; pat[n] && pat[n] != '/'; n++)
+		;
+	if (glob_meta(pat, n))
+		return (glob_dir(g, len, pat, n));
+	if (len + n + 1 >= PATH_MAX)
+		return (0);
+	for (; *pat && *pat != '/'; pat++)
+	{
+		if (*pat == '\\' && pat[1])
+			pat++;
+		g->path[len++] = *pat;
+	}
+	return (glob_walk(g, len, pat));
+}
+
+/**
+ * glob_fields - does pathname expansion on fields: a field with
+ * unquoted pattern characters becomes the sorted paths it matches, or
+ * stays as it is if it matches none
+ * @info: the parameter struct
+ * @buf: the fields, one after the other, with quoted characters escaped
+ * @n: the number of fields
+ * @fields: receives the NULL-terminated fields, in the arena
+ *
+ * Return: the number of fields, or -1 on malloc failure
+ */
+int glob_fields(info_t *info, char *buf, int n, char ***fields)
+{
+	pathglob_t g;
+	char *next;
+	size_t start;
+
+	g.info = info;
+	g.dirs = NULL;
+	g.fields = NULL;
+	g.nfields = 0;
+	g.size = 0;
+	for (; n > 0; n--, buf = next)
+	{
+		next = buf + _strlen(buf) + 1;
+		start = g.nfields;
+		if (glob_meta(buf, next - buf - 1) && glob_walk(&g, 0, buf))
+			return (-1);
+		if (g.nfields > start)
+			qsort(g.fields + start, g.nfields - start, sizeof(char *),
+					glob_cmp);
+		else if (glob_push(&g, glob_unescape(buf)))
+			return (-1);
+	}
+	if (glob_push(&g, ""))
+		return (-1);
+	g.fields[--g.nfields] = NULL;
+	*fields = g.fields;
+	return (g.nfields);
+}
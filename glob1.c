@@ -0,0 +1,165 @@
+#include "shell.h"
+
+/**
+ * dir_read - reads the names in a directory into the arena, the strings
+ * packed in one block that grows in place while it is read
+ * @info: the parameter struct
+ * @d: the cache entry, with its path set
+ *
+ * Return: 0 on success, even if the directory cannot be read, in which
+ *         case it has no names; 1 on malloc failure
+ */
+int dir_read(info_t *info, dircache_t *d)
+{
+	DIR *dir = opendir(*d->path ? d->path : ".");
+	struct dirent *ent;
+	char *names = NULL, *grown;
+	size_t len = 0, size = 0, n, i;
+
+	d->names = NULL;
+	d->count = 0;
+	while (dir && (ent = readdir(dir)) != NULL)
+	{
+		n = _strlen(ent->d_name) + 1;
+		if (len + n > size)
+		{
+			grown = arena_grow(&(info->arena), names, size, size * 2 + 4096);
+			if (!grown)
+				return (closedir(dir), 1);
+			names = grown;
+			size = size * 2 + 4096;
+		}
+		memcpy(names + len, ent->d_name, n);
+		len += n;
+		d->count++;
+	}
+	if (dir)
+		closedir(dir);
+	d->names = arena_alloc(&(info->arena), sizeof(char *) * (d->count + 1));
+	if (!d->names)
+		return (1);
+	for (i = 0; i < d->count; i++, names += _strlen(names) + 1)
+		d->names[i] = names;
+	return (0);
+}
+
+/**
+ * dir_cache - gives the names in a directory, reading it only the first
+ * time it is asked for while the same fields are expanded, so that e.g.
+ * `cp a/x*.log a/y*.log b` reads a once
+ * @g: the globber
+ * @path: the directory, "" for the current one
+ *
+ * Return: the cache entry, or NULL on malloc failure
+ */
+dircache_t *dir_cache(pathglob_t *g, char *path)
+{
+	dircache_t *d;
+
+	for (d = g->dirs; d; d = d->next)
+		if (!_strcmp(d->path, path))
+			return (d);
+	d = arena_alloc(&(g->info->arena), sizeof(dircache_t));
+	if (!d)
+		return (NULL);
+	d->path = arena_copy(&(g->info->arena), path, _strlen(path));
+	if (!d->path || dir_read(g->info, d))
+		return (NULL);
+	d->next = g->dirs;
+	g->dirs = d;
+	return (d);
+}
+
+/**
+ * glob_meta - checks if text has an unescaped *, ? or [ with a ] after it
+ * @s: the text, quoted characters escaped with a backslash
+ * @n: its length
+ *
+ * Return: 1 if it does, 0 otherwise
+ */
+int glob_meta(char *s, size_t n)
+{
+	size_t i, j;
+
+	for (i = 0; i < n; i++)
+	{
+		if (s[i] == '\\')
+			i++;
+		else if (s[i] == '*' || s[i] == '?')
+			return (1);
+		else if (s[i] == '[')
+			for (j = i + 2; j < n; j++)
+				if (s[j] == ']')
+					return (1);
+	}
+	return (0);
+}
+
+/**
+ * glob_prefix - measures the literal text a pattern starts with, and
+ * finds the literal suffix of a pattern of the common form prefix*suffix
+ * @pat: the pattern
+ * @suffix: receives the suffix, or NULL if the pattern has another form
+ *
+ * Return: the length of the literal prefix
+ */
+size_t glob_prefix(char *pat, char **suffix)
+{
+	size_t n = 0;
+	char *p;
+
+	while (pat[n] && !_strchr("*?[\\", pat[n]))
+		n++;
+	*suffix = NULL;
+	if (pat[n] != '*')
+		return (n);
+	for (p = pat + n + 1; *p && !_strchr("*?[\\", *p); p++)
+		;
+	if (!*p)
+		*suffix = pat + n + 1;
+	return (n);
+}
+
+/**
+ * glob_name - matches a name against a pattern, comparing the literal
+ * prefix and suffix found by glob_prefix() before calling fnmatch()
+ * @pat: the pattern
+ * @plen: the length of its literal prefix
+ * @suffix: its literal suffix, if it is of the form prefix*suffix
+ * @name: the name
+ *
+ * Return: 1 if it matches, 0 otherwise
+ */
+int glob_name(char *pat, size_t plen, char *suffix, char *name)
+{
+	size_t n, slen;
+
+	if (strncmp(name, pat, plen))
+		return (0);
+	if (!suffix)
+		return (!fnmatch(pat, name, 0));
+	n = _strlen(name);
+	slen = _strlen(suffix);
+	return (n >= plen + slen && !memcmp(name + n - slen, suffix, slen));
+}
+
+/**
+ * glob_unescape - removes the backslashes escaping characters of a field
+ * that is not expanded as a pattern
+ * @s: the field, changed in place
+ *
+ * Return: s
+ */
+char *glob_unescape(char *s)
+{
+	char *r = s, *w = s;
+
+	for (; *r; r++)
+	{
+		if (*r == '\\' && r[1])
+			r++;
+		*w++ = *r;
+	}
+	*w = '\0';
+	return (s);
+}
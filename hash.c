@@ -0,0 +1,148 @@
+#include "shell.h"
+
+/**
+ * hash_key - computes the bucket index of a command name
+ * @name: the command name
+ *
+ * Return: bucket index in [0, CMD_HASH_SIZE)
+ */
+unsigned int hash_key(char *name)
+{
+	unsigned long h = 5381;
+
+	while (*name)
+		h = ((h << 5) + h) + (unsigned char)*name++;
+	return (h % CMD_HASH_SIZE);
+}
+
+/**
+ * hash_find - looks up a command in the resolved command table
+ * @info: the parameter struct
+ * @name: the command name
+ *
+ * Return: the cache entry, or NULL if the command was never resolved
+ */
+cmdhash_t *hash_find(info_t *info, char *name)
+{
+	cmdhash_t *entry;
+
+	if (!info->cmd_hash)
+		return (NULL);
+	for (entry = info->cmd_hash[hash_key(name)]; entry; entry = entry->next)
+		if (_strcmp(entry->name, name) == 0)
+			return (entry);
+	return (NULL);
+}
+
+/**
+ * hash_add - records where a PATH search found a command
+ * @info: the parameter struct
+ * @name: the command name
+ * @path: the resolved path
+ *
+ * Return: the cache entry, or NULL on malloc failure
+ */
+cmdhash_t *hash_add(info_t *info, char *name, char *path)
+{
+	cmdhash_t *entry;
+	unsigned int k;
+
+	if (!info->cmd_hash)
+	{
+		info->cmd_hash = malloc(sizeof(cmdhash_t *) * CMD_HASH_SIZE);
+		if (!info->cmd_hash)
+			return (NULL);
+		_memset((void *)info->cmd_hash, 0,
+				sizeof(cmdhash_t *) * CMD_HASH_SIZE);
+	}
+	entry = malloc(sizeof(cmdhash_t));
+	if (!entry)
+		return (NULL);
+	entry->name = _strdup(name);
+	entry->path = _strdup(path);
+	entry->hits = 0;
+	if (!entry->name || !entry->path)
+	{
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return (NULL);
+	}
+	k = hash_key(name);
+	entry->next = info->cmd_hash[k];
+	info->cmd_hash[k] = entry;
+	return (entry);
+}
+
+/**
+ * hash_forget - forgets one resolved command, e.g. once its file is gone
+ * @info: the parameter struct
+ * @name: the command name
+ */
+void hash_forget(info_t *info, char *name)
+{
+	cmdhash_t **link, *entry;
+
+	for (link = info->cmd_hash ? info->cmd_hash + hash_key(name) : NULL;
+			link && *link; link = &(entry->next))
+	{
+		entry = *link;
+		if (_strcmp(entry->name, name))
+			continue;
+		*link = entry->next;
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return;
+	}
+}
+
+/**
+ * hash_clear - forgets every resolved command, e.g. after PATH changed
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void hash_clear(info_t *info)
+{
+	cmdhash_t *entry, *next;
+	int i;
+
+	if (!info->cmd_hash)
+		return;
+	for (i = 0; i < CMD_HASH_SIZE; i++)
+	{
+		for (entry = info->cmd_hash[i]; entry; entry = next)
+		{
+			next = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+		}
+	}
+	bfree((void **)&info->cmd_hash);
+}
+
+/**
+ * print_hash - prints the remembered command locations
+ * @info: the parameter struct
+ *
+ * Return: number of entries printed
+ */
+int print_hash(info_t *info)
+{
+	cmdhash_t *entry;
+	int i, n = 0;
+
+	for (i = 0; info->cmd_hash && i < CMD_HASH_SIZE; i++)
+		for (entry = info->cmd_hash[i]; entry; entry = entry->next)
+		{
+			if (!n++)
+				_puts("hits\tcommand\n");
+			_puts(convert_number(entry->hits, 10, 0));
+			_putchar('\t');
+			_puts(entry->path);
+			_putchar('\n');
+		}
+	return (n);
+}
@@ -0,0 +1,88 @@
+#include "shell.h"
+
+/**
+ * lex_pending - records a here-document whose body is to be read once
+ * the current line has been tokenized
+ * @lx: the lexer
+ * @r: the redirection, its target the delimiter as written
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int lex_pending(lexer_t *lx, redir_t *r)
+{
+	int n = lx->nheredocs;
+	redir_t **grown;
+
+	if (!(n & (n - 1)))
+	{
+		grown = arena_grow(&(lx->info->arena), lx->heredocs,
+				sizeof(redir_t *) * n, sizeof(redir_t *) * (n ? n * 2 : 1));
+		if (!grown)
+			return (1);
+		lx->heredocs = grown;
+	}
+	lx->heredocs[lx->nheredocs++] = r;
+	return (0);
+}
+
+/**
+ * here_delim - removes the quotes from a here-document delimiter
+ * @info: the parameter struct
+ * @word: the delimiter as written
+ * @quoted: set on if any part of it was quoted, in which case the body
+ *          is not expanded
+ *
+ * Return: the delimiter, in the arena, or NULL on malloc failure
+ */
+char *here_delim(info_t *info, char *word, int *quoted)
+{
+	char *delim = arena_copy(&(info->arena), word, _strlen(word)), *w;
+	char quote = 0;
+
+	*quoted = 0;
+	if (!delim)
+		return (NULL);
+	for (w = delim; *word; word++)
+	{
+		if (*word == quote || (!quote && (*word == '\'' || *word == '"')))
+		{
+			quote = quote ? 0 : *word;
+			*quoted = 1;
+			continue;
+		}
+		if (*word == '\\' && quote != '\'' && word[1])
+			word++, *quoted = 1;
+		*w++ = *word;
+	}
+	*w = '\0';
+	return (delim);
+}
+
+/**
+ * lex_heredocs - reads the bodies of the here-documents recorded on the
+ * line just tokenized, in order, into their redirections
+ * @lx: the lexer
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int lex_heredocs(lexer_t *lx)
+{
+	redir_t *r;
+	char *delim;
+	int i, quoted;
+
+	for (i = 0; i < lx->nheredocs; i++)
+	{
+		r = lx->heredocs[i];
+		delim = here_delim(lx->info, r->target, &quoted);
+		if (!delim)
+			return (1);
+		r->target = heredoc_body(lx->info, delim, r->flags == REDIR_HERE_TAB);
+		if (!r->target)
+			return (1);
+		r->flags = quoted ? REDIR_HERE_RAW : REDIR_HEREDOC;
+	}
+	lx->heredocs = NULL;
+	lx->nheredocs = 0;
+	return (0);
+}
@@ -0,0 +1,111 @@
+#include "shell.h"
+
+/**
+ * expand_heredoc - expands the body of a here-document: parameters are
+ * substituted as inside double quotes, but quotes are kept, and a
+ * backslash only escapes $, `, \ and a newline
+ * @info: the parameter struct
+ * @s: the body
+ *
+ * Return: the expansion, in the arena, or NULL on error
+ */
+char *expand_heredoc(info_t *info, char *s)
+{
+	expand_t e = {NULL, NULL, 0, 0, 0, 0, 0, 0};
+	char *p;
+
+	e.info = info;
+	while (*s)
+	{
+		if (*s == '\\' && s[1] && _strchr("$`\\\n", s[1]))
+		{
+			if (s[1] != '\n' && exp_put(&e, s + 1, 1, 0))
+				return (NULL);
+			s += 2;
+		}
+		else if (*s == '$' || *s == '`')
+		{
+			s = exp_param(&e, s, 1);
+			if (!s)
+				return (NULL);
+		}
+		else
+		{
+			for (p = s + 1; *p && !_strchr("\\$`", *p); p++)
+				;
+			if (exp_put(&e, s, p - s, 0))
+				return (NULL);
+			s = p;
+		}
+	}
+	if (exp_grow(&e, 1))
+		return (NULL);
+	e.buf[e.len] = '\0';
+	return (e.buf);
+}
+
+/**
+ * here_text - gives the text a here-document or here-string feeds in
+ * @info: the parameter struct
+ * @r: the redirection as parsed
+ *
+ * Return: the text, or NULL on error
+ */
+char *here_text(info_t *info, redir_t *r)
+{
+	char *word, *text;
+	size_t n;
+
+	if (r->flags == REDIR_HERE_RAW)
+		return (r->target);
+	if (r->flags != REDIR_HERESTR)
+		return (expand_heredoc(info, r->target));
+	word = expand_word(info, r->target, 0);
+	if (!word)
+		return (NULL);
+	n = _strlen(word);
+	text = arena_alloc(&(info->arena), n + 2);
+	if (!text)
+		return (NULL);
+	memcpy(text, word, n);
+	text[n] = '\n';
+	text[n + 1] = '\0';
+	return (text);
+}
+
+/**
+ * here_fd - makes a descriptor to read a text from, nothing written to
+ * disk: a pipe if the text fits in one without blocking, otherwise an
+ * in-memory file from memfd_create()
+ * @text: the text
+ *
+ * Return: the descriptor, close-on-exec, or -1 on error
+ */
+int here_fd(char *text)
+{
+	size_t len = _strlen(text), off = 0;
+	ssize_t w;
+	int fds[2], fd;
+
+	if (len <= PIPE_BUF)
+	{
+		if (pipe2(fds, O_CLOEXEC))
+			return (-1);
+		w = write(fds[1], text, len);
+		close(fds[1]);
+		if (w == (ssize_t)len)
+			return (fds[0]);
+		close(fds[0]);
+		return (-1);
+	}
+	fd = memfd_create("here-document", MFD_CLOEXEC);
+	for (w = 0; fd != -1 && off < len; off += w)
+	{
+		w = write(fd, text + off, len - off);
+		if (w <= 0)
+			return (close(fd), -1);
+	}
+	if (fd != -1 && lseek(fd, 0, SEEK_SET))
+		return (close(fd), -1);
+	return (fd);
+}
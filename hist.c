@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+ * hist_at - gives a history entry by its position
+ * @h: the history
+ * @i: the position, 0 for the oldest entry
+ *
+ * Return: the entry
+ */
+histent_t *hist_at(history_t *h, size_t i)
+{
+	return (h->ents + (h->first + i) % h->max);
+}
+
+/**
+ * hist_fits - finds room for a text in the slab: at its head, or at the
+ * start of the slab if the texts have not wrapped yet and the text does
+ * not fit past the newest one
+ * @h: the history
+ * @n: the size of the text, its NUL included
+ *
+ * Return: the offset the text can go at, or -1 if there is no room
+ */
+long hist_fits(history_t *h, size_t n)
+{
+	size_t tail;
+
+	if (!h->count)
+		return (n <= h->size ? 0 : -1);
+	tail = hist_at(h, 0)->off;
+	if (hist_at(h, h->count - 1)->off < tail)
+		return (h->head + n <= tail ? (long)h->head : -1);
+	if (h->head + n <= h->size)
+		return (h->head);
+	return (n <= tail ? 0 : -1);
+}
+
+/**
+ * hist_grow - moves the texts to a slab twice as large, or larger if
+ * needed, in order from its start
+ * @h: the history
+ * @n: the size of the text to make room for
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_grow(history_t *h, size_t n)
+{
+	size_t size = h->size ? h->size * 2 : HIST_SLAB, len = 0, i;
+	histent_t *e;
+	char *slab;
+
+	for (i = 0; i < h->count; i++)
+		n += hist_at(h, i)->len + 1;
+	while (size < n)
+		size *= 2;
+	slab = malloc(size);
+	if (!slab)
+		return (1);
+	for (i = 0; i < h->count; i++)
+	{
+		e = hist_at(h, i);
+		memcpy(slab + len, h->slab + e->off, e->len + 1);
+		e->off = len;
+		len += e->len + 1;
+	}
+	free(h->slab);
+	h->slab = slab;
+	h->size = size;
+	h->head = len;
+	return (0);
+}
+
+/**
+ * hist_push - appends an entry to the history, dropping the oldest one if
+ * there are h->max; the ring grows until it has room for that many, the
+ * oldest entry at its start until then, and the slab grows when it is full
+ * @h: the history
+ * @text: the text of the entry, not necessarily NUL-terminated
+ * @n: its length
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_push(history_t *h, char *text, size_t n)
+{
+	size_t cap = h->cap * 2 > 256 ? h->cap * 2 : 256;
+	histent_t *e;
+	long off;
+
+	if (h->count == h->cap && h->cap < h->max)
+	{
+		cap = cap < h->max ? cap : h->max;
+		e = _realloc(h->ents, sizeof(histent_t) * h->cap,
+				sizeof(histent_t) * cap);
+		if (!e)
+			return (1);
+		h->ents = e;
+		h->cap = cap;
+	}
+	if (h->count == h->max)
+	{
+		h->first = (h->first + 1) % h->max;
+		h->count--;
+		h->base++;
+	}
+	off = hist_fits(h, n + 1);
+	if (off < 0 && hist_grow(h, n + 1))
+		return (1);
+	if (off < 0)
+		off = h->head;
+	e = hist_at(h, h->count++);
+	e->off = off;
+	e->len = n;
+	e->hash = env_hash(text, n);
+	memcpy(h->slab + off, text, n);
+	h->slab[off + n] = '\0';
+	h->head = off + n + 1;
+	return (0);
+}
+
+/**
+ * hist_add - records a command in the history as HISTCONTROL asks: not
+ * if it starts with a space under ignorespace, not if it is the same as
+ * the last one under ignoredups, and in place of the same older ones
+ * under erasedups, those of this shell; ignoreboth is ignorespace and
+ * ignoredups. It is saved to the history file by hist_flush()
+ * @info: the parameter struct
+ * @text: the command, not necessarily NUL-terminated
+ * @n: its length
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_add(info_t *info, char *text, size_t n)
+{
+	history_t *h = &(info->history);
+	int control = hist_control(info);
+	size_t hash = env_hash(text, n);
+
+	if ((control & HIST_IGNORESPACE) && n && *text == ' ')
+		return (0);
+	if ((control & HIST_IGNOREDUPS) && hist_is_last(h, text, n, hash))
+		return (0);
+	if (control & HIST_ERASEDUPS)
+		hist_erase(h, text, n, hash);
+	if (hist_push(h, text, n))
+		return (1);
+	if (h->unsaved < h->count)
+		h->unsaved++;
+	return (0);
+}
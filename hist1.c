@@ -0,0 +1,92 @@
+#include "shell.h"
+
+/**
+ * hist_same - checks if a history entry has a given text, comparing the
+ * texts only if their hashes are the same
+ * @h: the history
+ * @e: the entry
+ * @text: the text
+ * @n: its length
+ * @hash: its hash, see env_hash()
+ *
+ * Return: 1 if it has, 0 otherwise
+ */
+int hist_same(history_t *h, histent_t *e, char *text, size_t n, size_t hash)
+{
+	return (e->hash == hash && e->len == n &&
+			!memcmp(h->slab + e->off, text, n));
+}
+
+/**
+ * hist_erase - removes the history entries with a given text, moving the
+ * newer entries down; the texts removed stay in the slab until the
+ * entries before them are dropped; the newer entries being renumbered,
+ * the search index is dropped to be built again
+ * @h: the history
+ * @text: the text
+ * @n: its length
+ * @hash: its hash
+ */
+void hist_erase(history_t *h, char *text, size_t n, size_t hash)
+{
+	size_t i, kept = 0, saved = h->count - h->unsaved;
+
+	for (i = 0; i < h->count; i++)
+	{
+		if (hist_same(h, hist_at(h, i), text, n, hash))
+		{
+			h->unsaved -= i >= saved;
+			continue;
+		}
+		if (kept != i)
+			*hist_at(h, kept) = *hist_at(h, i);
+		kept++;
+	}
+	if (kept < h->count)
+		hist_index_free(&(h->index));
+	h->count = kept;
+	if (!kept)
+		h->head = 0;
+}
+
+/**
+ * hist_control - reads HISTCONTROL, a list of ignorespace, ignoredups,
+ * ignoreboth and erasedups
+ * @info: the parameter struct
+ *
+ * Return: the HIST_IGNOREDUPS, HIST_IGNORESPACE and HIST_ERASEDUPS flags
+ */
+int hist_control(info_t *info)
+{
+	char *v = env_value(info, "HISTCONTROL");
+	int flags = 0;
+
+	if (!v)
+		return (0);
+	if (strstr(v, "ignoredups") || strstr(v, "ignoreboth"))
+		flags |= HIST_IGNOREDUPS;
+	if (strstr(v, "ignorespace") || strstr(v, "ignoreboth"))
+		flags |= HIST_IGNORESPACE;
+	if (strstr(v, "erasedups"))
+		flags |= HIST_ERASEDUPS;
+	return (flags);
+}
+
+/**
+ * hist_free - frees the history
+ * @h: the history
+ */
+void hist_free(history_t *h)
+{
+	free(h->ents);
+	free(h->slab);
+	free(h->lines);
+	hist_index_free(&(h->index));
+	if (h->map)
+		munmap(h->map, h->maplen);
+	if (h->fd != -1)
+		close(h->fd);
+	_memset((void *)h, 0, sizeof(history_t));
+	h->fd = -1;
+	h->max = HIST_MAX;
+}
@@ -0,0 +1,119 @@
+#include "shell.h"
+
+/**
+ * hist_lines - finds the starts of the lines of the mapped history file,
+ * from the newest back, until want of them are known or the file has no
+ * more; only the pages holding them are read
+ * @h: the history
+ * @want: the number of lines wanted
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_lines(history_t *h, size_t want)
+{
+	size_t p, *grown, cap = h->linecap * 2 + 256;
+
+	if (!h->map || (h->linecap && !h->lines[h->nlines]))
+		return (0);
+	while (h->nlines < want)
+	{
+		if (h->nlines + 2 > h->linecap)
+		{
+			grown = _realloc(h->lines, h->linecap * sizeof(size_t),
+					cap * sizeof(size_t));
+			if (!grown)
+				return (1);
+			if (!h->linecap)
+			{
+				*grown = h->maplen;
+				while (*grown && h->map[*grown - 1] != '\n')
+					(*grown)--;
+			}
+			h->lines = grown;
+			h->linecap = cap;
+			cap = cap * 2 + 256;
+		}
+		p = h->lines[h->nlines];
+		if (!p)
+			break;
+		for (p--; p && h->map[p - 1] != '\n'; p--)
+			;
+		h->lines[++h->nlines] = p;
+	}
+	return (0);
+}
+
+/**
+ * hist_count - gives the number of history entries: the last lines of the
+ * history file, as many as the entries of this shell leave room for in
+ * h->max, then those entries
+ * @h: the history
+ *
+ * Return: the number of entries
+ */
+size_t hist_count(history_t *h)
+{
+	size_t room = h->max - h->count;
+
+	hist_lines(h, h->max);
+	return ((h->nlines < room ? h->nlines : room) + h->count);
+}
+
+/**
+ * hist_entry - gives the text of a history entry
+ * @h: the history, counted by hist_count()
+ * @i: the position of the entry, 0 for the oldest
+ * @len: receives the length of the text
+ *
+ * Return: the text, in the slab and NUL-terminated for an entry of this
+ *         shell, in the mapped file and ending with '\n' for a line of it
+ */
+char *hist_entry(history_t *h, size_t i, size_t *len)
+{
+	size_t files = hist_count(h) - h->count, k;
+	histent_t *e;
+
+	if (i < files)
+	{
+		k = files - i;
+		*len = h->lines[k - 1] - h->lines[k] - 1;
+		return (h->map + h->lines[k]);
+	}
+	e = hist_at(h, i - files);
+	*len = e->len;
+	return (h->slab + e->off);
+}
+
+/**
+ * hist_number - gives the number of a history entry, numbering the lines
+ * of the file left from 0 so nothing is renumbered as the oldest drop
+ * @h: the history, counted by hist_count()
+ * @i: the position of the entry
+ *
+ * Return: the number
+ */
+size_t hist_number(history_t *h, size_t i)
+{
+	size_t lines = h->nlines < h->max ? h->nlines : h->max;
+
+	return (lines - (hist_count(h) - h->count) + h->base + i);
+}
+
+/**
+ * hist_is_last - checks if a text is the newest history entry, looking
+ * at no more of the file than its last line
+ * @h: the history
+ * @text: the text, not necessarily NUL-terminated
+ * @n: its length
+ * @hash: its hash, see env_hash()
+ *
+ * Return: 1 if it is, 0 otherwise
+ */
+int hist_is_last(history_t *h, char *text, size_t n, size_t hash)
+{
+	if (h->count)
+		return (hist_same(h, hist_at(h, h->count - 1), text, n, hash));
+	hist_lines(h, 1);
+	return (h->nlines && h->lines[0] - h->lines[1] - 1 == n &&
+			!memcmp(h->map + h->lines[1], text, n));
+}
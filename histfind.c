@@ -0,0 +1,142 @@
+#include "shell.h"
+
+/**
+ * hist_slot - finds the slot of a trigram in the search index
+ * @ix: the index
+ * @key: the trigram, see TRIGRAM()
+ * @add: on to put the trigram in a free slot if it is not there, the
+ *       index growing first if it would be more than half full
+ *
+ * Return: the slot, or NULL if the trigram is not there and add is off,
+ *         or on malloc failure
+ */
+trigram_t *hist_slot(histindex_t *ix, unsigned int key, int add)
+{
+	unsigned int hash = key * 2654435761u;
+	size_t i;
+
+	if (add && (ix->used + 1) * 2 > ix->size && hist_rehash(ix))
+		return (NULL);
+	if (!ix->size)
+		return (NULL);
+	i = (hash ^ hash >> 16) & (ix->size - 1);
+	while (ix->slots[i].key && ix->slots[i].key != key)
+		i = (i + 1) & (ix->size - 1);
+	if (!ix->slots[i].key && !add)
+		return (NULL);
+	if (!ix->slots[i].key)
+		ix->used++;
+	ix->slots[i].key = key;
+	return (ix->slots + i);
+}
+
+/**
+ * hist_rehash - moves the trigrams of the search index to twice as many
+ * slots, or to HIST_INDEX_SLOTS the first time
+ * @ix: the index
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_rehash(histindex_t *ix)
+{
+	histindex_t grown = *ix;
+	size_t i;
+
+	grown.size = ix->size ? ix->size * 2 : HIST_INDEX_SLOTS;
+	grown.used = 0;
+	grown.slots = malloc(sizeof(trigram_t) * grown.size);
+	if (!grown.slots)
+		return (1);
+	_memset((void *)grown.slots, 0, sizeof(trigram_t) * grown.size);
+	for (i = 0; i < ix->size; i++)
+		if (ix->slots[i].key)
+			*hist_slot(&grown, ix->slots[i].key, 1) = ix->slots[i];
+	free(ix->slots);
+	*ix = grown;
+	return (0);
+}
+
+/**
+ * hist_index_add - adds an entry to the search index, under each trigram
+ * of its text once
+ * @ix: the index
+ * @text: the text
+ * @len: its length
+ * @id: the number of the entry less ix->start, higher than any before
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_index_add(histindex_t *ix, char *text, size_t len, unsigned int id)
+{
+	unsigned char *s = (unsigned char *)text;
+	unsigned int *ids;
+	trigram_t *t;
+	size_t k;
+
+	for (k = 0; k + 3 <= len; k++)
+	{
+		t = hist_slot(ix, TRIGRAM(s + k), 1);
+		if (!t)
+			return (1);
+		if (t->count && t->ids[t->count - 1] == id)
+			continue;
+		if (t->count == t->size)
+		{
+			ids = _realloc(t->ids, sizeof(int) * t->size,
+					sizeof(int) * (t->size * 2 + 4));
+			if (!ids)
+				return (1);
+			t->ids = ids;
+			t->size = t->size * 2 + 4;
+		}
+		t->ids[t->count++] = id;
+	}
+	return (0);
+}
+
+/**
+ * hist_index - brings the search index up to date with the entries added
+ * since the last search, indexing them all the first time, and all again
+ * once more entries were dropped from the index than are left in it
+ * @h: the history
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int hist_index(history_t *h)
+{
+	histindex_t *ix = &(h->index);
+	size_t n = hist_count(h), first = n ? hist_number(h, 0) : 0, len;
+	char *text;
+
+	if (ix->slots && first - ix->start > n)
+		hist_index_free(ix);
+	if (!ix->slots)
+	{
+		if (hist_rehash(ix))
+			return (1);
+		ix->start = ix->next = first;
+	}
+	if (ix->next < first)
+		ix->next = first;
+	for (; ix->next < first + n; ix->next++)
+	{
+		text = hist_entry(h, ix->next - first, &len);
+		if (hist_index_add(ix, text, len, ix->next - ix->start))
+			return (hist_index_free(ix), 1);
+	}
+	return (0);
+}
+
+/**
+ * hist_index_free - frees the search index, to be built at the next search
+ * @ix: the index
+ */
+void hist_index_free(histindex_t *ix)
+{
+	size_t i;
+
+	for (i = 0; i < ix->size; i++)
+		free(ix->slots[i].ids);
+	free(ix->slots);
+	_memset((void *)ix, 0, sizeof(histindex_t));
+}
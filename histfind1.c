@@ -0,0 +1,148 @@
+#include "shell.h"
+
+/**
+ * hist_find - finds the newest history entry before a position with a
+ * pattern in it: from the entries of the rarest trigram of the pattern,
+ * or from all of them if it is too short to have one
+ * @h: the history
+ * @pat: the pattern, not necessarily NUL-terminated
+ * @n: its length
+ * @before: the position to search back from, hist_count() for all
+ *
+ * Return: the position of the entry, or -1 if there is none
+ */
+long hist_find(history_t *h, char *pat, size_t n, size_t before)
+{
+	histindex_t *ix = &(h->index);
+	trigram_t *t, *rare = NULL;
+	size_t k, lo = 0, hi, len, first;
+	char *text;
+
+	if (n >= 3 && !hist_index(h))
+	{
+		for (k = 0; k + 3 <= n; k++)
+		{
+			t = hist_slot(ix, TRIGRAM((unsigned char *)pat + k), 0);
+			if (!t)
+				return (-1);
+			rare = !rare || t->count < rare->count ? t : rare;
+		}
+		first = hist_number(h, 0);
+		for (hi = rare->count; lo < hi; )
+		{
+			k = lo + (hi - lo) / 2;
+			if (rare->ids[k] + ix->start < first + before)
+				lo = k + 1;
+			else
+				hi = k;
+		}
+		while (lo-- && rare->ids[lo] + ix->start >= first)
+		{
+			k = rare->ids[lo] + ix->start - first;
+			text = hist_entry(h, k, &len);
+			if (memmem(text, len, pat, n))
+				return (k);
+		}
+		return (-1);
+	}
+	while (before--)
+	{
+		text = hist_entry(h, before, &len);
+		if (memmem(text, len, pat, n))
+			return (before);
+	}
+	return (-1);
+}
+
+/**
+ * hist_matches - finds the newest history entries with a pattern in them
+ * @h: the history
+ * @pat: the pattern
+ * @n: its length
+ * @pos: receives the positions of the entries, newest first
+ * @max: the most entries to find
+ *
+ * Return: the number of entries found
+ */
+size_t hist_matches(history_t *h, char *pat, size_t n, size_t *pos,
+		size_t max)
+{
+	size_t found = 0;
+	long at = hist_count(h);
+
+	while (found < max && (at = hist_find(h, pat, n, at)) >= 0)
+		pos[found++] = at;
+	return (found);
+}
+
+/**
+ * hist_show - prints history entries with their numbers, as `history`
+ * does, a batch of lines per write
+ * @h: the history
+ * @pos: the positions of the entries, NULL for the first n
+ * @n: the number of entries
+ */
+void hist_show(history_t *h, size_t *pos, size_t n)
+{
+	struct iovec iov[96];
+	char nums[32][24], *num;
+	size_t i = 0, k, len, at;
+
+	_putchar(BUF_FLUSH);
+	while (i < n)
+	{
+		for (k = 0; k < 32 && i < n; k++, i++)
+		{
+			at = pos ? pos[i] : i;
+			num = convert_number(hist_number(h, at), 10, 0);
+			_strcpy(nums[k], num);
+			_strcat(nums[k], ": ");
+			iov[3 * k].iov_base = nums[k];
+			iov[3 * k].iov_len = _strlen(nums[k]);
+			iov[3 * k + 1].iov_base = hist_entry(h, at, &len);
+			iov[3 * k + 1].iov_len = len;
+			iov[3 * k + 2].iov_base = "\n";
+			iov[3 * k + 2].iov_len = 1;
+		}
+		if (writev(STDOUT_FILENO, iov, 3 * k) < 0)
+			return;
+	}
+}
+
+/**
+ * hist_search - implements `history -s pattern [-n count]`: prints the
+ * entries with the pattern in them, or the newest count of them, oldest
+ * first as `history` does
+ * @info: the parameter struct
+ * @pattern: the pattern
+ * @count: the count, or NULL for all of them
+ *
+ * Return: 0 if an entry was found, 1 if none was, 2 on a bad count
+ */
+int hist_search(info_t *info, char *pattern, char *count)
+{
+	history_t *h = &(info->history);
+	size_t n = hist_count(h), found, i, swap, *pos;
+	int max = count ? _erratoi(count) : -1;
+
+	if (count && max < 0)
+	{
+		_eputs("history: usage: history -s pattern [-n count]\n");
+		return (2);
+	}
+	if (count && (size_t)max < n)
+		n = max;
+	pos = malloc(sizeof(size_t) * (n + 1));
+	if (!pos)
+		return (1);
+	found = hist_matches(h, pattern, _strlen(pattern), pos, n);
+	for (i = 0; i < found / 2; i++)
+	{
+		swap = pos[i];
+		pos[i] = pos[found - 1 - i];
+		pos[found - 1 - i] = swap;
+	}
+	hist_show(h, pos, found);
+	free(pos);
+	return (found ? 0 : 1);
+}
@@ -0,0 +1,154 @@
+#include "shell.h"
+
+/**
+ * hist_lock - opens the history file for appending, the first time an
+ * entry is saved, and locks it; it is opened again if it was replaced by
+ * a compaction since, so that every shell appends to the same file
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 if the file cannot be opened or locked
+ */
+int hist_lock(info_t *info)
+{
+	history_t *h = &(info->history);
+	char *filename = get_history_file(info);
+	struct stat st, cur;
+	int tries;
+
+	if (!h->limit)
+		h->limit = HIST_COMPACT;
+	for (tries = 0; filename && tries < 3; tries++)
+	{
+		if (h->fd == -1)
+			h->fd = open(filename, O_RDWR | O_APPEND | O_CREAT |
+					O_CLOEXEC, 0644);
+		if (h->fd == -1 || flock(h->fd, LOCK_EX))
+			break;
+		if (!stat(filename, &cur) && !fstat(h->fd, &st) &&
+				cur.st_ino == st.st_ino &&
+				cur.st_dev == st.st_dev)
+			return (free(filename), 0);
+		close(h->fd);
+		h->fd = -1;
+	}
+	free(filename);
+	return (1);
+}
+
+/**
+ * hist_append - appends the entries not saved yet to the history file,
+ * one line each, with as few writes as it takes
+ * @h: the history, its file open
+ *
+ * Return: 0 on success, 1 on write error
+ */
+int hist_append(history_t *h)
+{
+	struct iovec iov[64];
+	size_t i = h->count - h->unsaved;
+	histent_t *e;
+	int k;
+
+	while (i < h->count)
+	{
+		for (k = 0; k + 2 <= 64 && i < h->count; i++)
+		{
+			e = hist_at(h, i);
+			iov[k].iov_base = h->slab + e->off;
+			iov[k++].iov_len = e->len;
+			iov[k].iov_base = "\n";
+			iov[k++].iov_len = 1;
+		}
+		if (writev(h->fd, iov, k) < 0)
+			return (1);
+	}
+	h->unsaved = 0;
+	return (0);
+}
+
+/**
+ * hist_tail - finds where the last lines of a text start
+ * @buf: the text
+ * @size: its length
+ * @max: the number of lines
+ *
+ * Return: the offset of the first of them
+ */
+size_t hist_tail(char *buf, size_t size, size_t max)
+{
+	size_t p = size, lines = 0;
+
+	while (p && lines <= max)
+		lines += buf[--p] == '\n';
+	return (lines > max ? p + 1 : 0);
+}
+
+/**
+ * hist_compact - replaces the history file with one of its last h->max
+ * lines once it has grown past h->limit; it is written aside and renamed
+ * over the file, never rewritten in place, so that the shells which
+ * mapped it at startup keep it whole, see read_history(), and the others
+ * open the new one before they next append, see hist_lock()
+ * @info: the parameter struct, the file locked
+ */
+void hist_compact(info_t *info)
+{
+	history_t *h = &(info->history);
+	char *filename = NULL, *tmp = NULL, *buf;
+	size_t keep = 0;
+	struct stat st;
+	int fd = -1;
+
+	if (fstat(h->fd, &st) || st.st_size <= h->limit)
+		return;
+	buf = malloc(st.st_size);
+	if (buf && pread(h->fd, buf, st.st_size, 0) == st.st_size)
+		filename = get_history_file(info);
+	if (filename)
+		tmp = malloc(_strlen(filename) + 5);
+	if (tmp)
+	{
+		keep = st.st_size - hist_tail(buf, st.st_size, h->max);
+		_strcpy(tmp, filename);
+		_strcat(tmp, ".new");
+		fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+				st.st_mode & 0777);
+	}
+	if (fd != -1 && write(fd, buf + st.st_size - keep, keep) ==
+			(ssize_t)keep && !fsync(fd) && !rename(tmp, filename))
+		st.st_size = keep;
+	else if (fd != -1)
+		unlink(tmp);
+	if (fd != -1)
+		close(fd);
+	h->limit = st.st_size * 2 > HIST_COMPACT ? st.st_size * 2 :
+		HIST_COMPACT;
+	free(buf);
+	free(filename);
+	free(tmp);
+}
+
+/**
+ * hist_flush - saves the entries not saved yet in one batch, holding an
+ * flock() on the history file so that shells sharing it neither mix
+ * their lines nor compact it under each other; the file is fsync()'ed
+ * when sync is on or HIST_SYNC_SECS have passed since it last was
+ * @info: the parameter struct
+ * @sync: on to fsync() the file in any case, as at exit
+ */
+void hist_flush(info_t *info, int sync)
+{
+	history_t *h = &(info->history);
+	time_t now = time(NULL);
+
+	if ((!h->unsaved && (!sync || h->fd == -1)) || hist_lock(info))
+		return;
+	if (h->unsaved && !hist_append(h))
+		hist_compact(info);
+	if (sync || now - h->synced >= HIST_SYNC_SECS)
+	{
+		fsync(h->fd);
+		h->synced = now;
+	}
+	flock(h->fd, LOCK_UN);
+}
@@ -24,119 +24,54 @@ char *get_history_file(info_t *info)
 }
 
 /**
- * write_history - Creates a file or appends to an existing file for history.
+ * write_history - Saves the entries not saved yet and closes the history
+ * file, as the shell exits; see hist_flush().
  * @info: The parameter struct.
  *
  * Return: 1 on success, -1 on failure.
  */
 int write_history(info_t *info)
 {
-    ssize_t fd;
-    char *filename = get_history_file(info);
-    list_t *node = NULL;
-
-    if (!filename)
-        return (-1);
-
-    fd = open(filename, O_CREAT | O_TRUNC | O_RDWR, 0644);
-    free(filename);
-    if (fd == -1)
+    hist_flush(info, 1);
+    if (info->history.fd == -1)
         return (-1);
-    for (node = info->history; node; node = node->next)
-    {
-        _putsfd(node->str, fd);
-        _putfd('\n', fd);
-    }
-    _putfd(BUF_FLUSH, fd);
-    close(fd);
+    close(info->history.fd);
+    info->history.fd = -1;
     return (1);
 }
 
 /**
- * read_history - Reads history from a file.
+ * read_history - Maps the history file read-only as it is at startup;
+ * its lines are only found, from the end back, once the history is
+ * looked at, see hist2.c. Its entries are not copied: the file is
+ * compacted into a new one, not in place, so the mapping stays whole.
+ * HISTSIZE, if set to a positive number, is how many entries are kept.
  * @info: The parameter struct.
  *
- * Return: The history count on success, 0 on failure.
+ * Return: 1 if the file was mapped, 0 otherwise.
  */
 int read_history(info_t *info)
 {
-    int i, last = 0, linecount = 0;
-    ssize_t fd, rdlen, fsize = 0;
     struct stat st;
-    char *buf = NULL, *filename = get_history_file(info);
+    char *filename = get_history_file(info), *map;
+    char *size = env_value(info, "HISTSIZE");
+    int fd;
 
+    if (size && _erratoi(size) > 0)
+        info->history.max = _erratoi(size);
     if (!filename)
         return (0);
-
-    fd = open(filename, O_RDONLY);
+    fd = open(filename, O_RDONLY | O_CLOEXEC);
     free(filename);
     if (fd == -1)
         return (0);
-    if (!fstat(fd, &st))
-        fsize = st.st_size;
-    if (fsize < 2)
-        return (0);
-    buf = malloc(sizeof(char) * (fsize + 1));
-    if (!buf)
-        return (0);
-    rdlen = read(fd, buf, fsize);
-    buf[fsize] = '\0';
-    if (rdlen <= 0)
-        return (free(buf), 0);
+    if (fstat(fd, &st) || st.st_size < 2)
+        return (close(fd), 0);
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
     close(fd);
-    for (i = 0; i < fsize; i++)
-        if (buf[i] == '\n')
-        {
-            buf[i] = '\0';
-            build_history_list(info, buf + last, linecount++);
-            last = i + 1;
-        }
-    if (last != i)
-        build_history_list(info, buf + last, linecount++);
-    free(buf);
-    info->histcount = linecount;
-    while (info->histcount-- >= HIST_MAX)
-        delete_node_at_index(&(info->history), 0);
-    renumber_history(info);
-    return (info->histcount);
-}
-
-/**
- * build_history_list - Adds an entry to the history linked list.
- * @info: The parameter struct.
- * @buf: The buffer.
- * @linecount: The history line count (histcount).
- *
- * Return: Always 0.
- */
-int build_history_list(info_t *info, char *buf, int linecount)
-{
-    list_t *node = NULL;
-
-    if (info->history)
-        node = info->history;
-    add_node_end(&node, buf, linecount);
-
-    if (!info->history)
-        info->history = node;
-    return (0);
-}
-
-/**
- * renumber_history - Renumbers the history linked list after changes.
- * @info: The parameter struct.
- *
- * Return: The new histcount.
- */
-int renumber_history(info_t *info)
-{
-    list_t *node = info->history;
-    int i = 0;
-
-    while (node)
-    {
-        node->num = i++;
-        node = node->next;
-    }
-    return (info->histcount = i);
+    if (map == MAP_FAILED)
+        return (0);
+    info->history.map = map;
+    info->history.maplen = st.st_size;
+    return (1);
 }
@@ -0,0 +1,164 @@
+#include "shell.h"
+
+static volatile sig_atomic_t child_pending;
+
+/**
+ * sigchldHandler - notes that a child changed state, the actual reaping
+ * is done by reap_jobs() outside of signal context
+ * @sig_num: The signal number.
+ *
+ * Return: Void.
+ */
+void sigchldHandler(__attribute__((unused))int sig_num)
+{
+	child_pending = 1;
+}
+
+/**
+ * init_jobs - installs the SIGCHLD handler used to reap background jobs,
+ * and turns job control on if the shell is interactive
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void init_jobs(info_t *info)
+{
+	struct sigaction sa;
+
+	info->monitor = interactive(info);
+	_memset((void *)&sa, 0, sizeof(sa));
+	sa.sa_handler = sigchldHandler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGCHLD, &sa, NULL);
+}
+
+/**
+ * add_job - puts a started pipeline in the job table, and reports it if
+ * it was run in the background
+ * @info: the parameter struct
+ * @pids: malloc'ed pids of the stages, 0 for stages that did not start;
+ *        the job takes ownership of it
+ * @n: the number of stages
+ * @status: the status to report if the last stage did not start
+ * @cmd: malloc'ed command text, owned by the job
+ *
+ * Return: the new job, or NULL if nothing was started
+ */
+job_t *add_job(info_t *info, pid_t *pids, int n, int status, char *cmd)
+{
+	job_t *job, **tail = &(info->jobs);
+	int i, id = 0;
+
+	job = malloc(sizeof(job_t));
+	if (!job)
+		return (free(pids), free(cmd), NULL);
+	_memset((void *)job, 0, sizeof(job_t));
+	for (i = 0; i < n; i++)
+		if (pids[i])
+		{
+			job->pgid = job->pgid ? job->pgid : pids[i];
+			info->last_bg = pids[i];
+			job->running++;
+		}
+	if (!job->running)
+		return (free(pids), free(cmd), free(job), NULL);
+	for (; *tail; tail = &((*tail)->next))
+		id = (*tail)->id > id ? (*tail)->id : id;
+	job->id = id + 1;
+	job->pids = pids;
+	job->npids = n;
+	job->status = status;
+	job->cmd = cmd;
+	*tail = job;
+	if (info->background && interactive(info))
+	{
+		_putchar('[');
+		_puts(convert_number(job->id, 10, 0));
+		_puts("] ");
+		_puts(convert_number(info->last_bg, 10, 0));
+		_putchar('\n');
+	}
+	return (job);
+}
+
+/**
+ * update_job - records a state change reported by waitpid()
+ * @info: the parameter struct
+ * @pid: the pid waitpid() returned
+ * @wstatus: the status waitpid() filled in
+ *
+ * Return: the job the pid belongs to, or NULL
+ */
+job_t *update_job(info_t *info, pid_t pid, int wstatus)
+{
+	job_t *job;
+	int i;
+
+	for (job = info->jobs; job; job = job->next)
+		for (i = 0; i < job->npids; i++)
+		{
+			if (job->pids[i] != pid)
+				continue;
+			if (WIFSTOPPED(wstatus))
+				job->state = JOB_STOPPED;
+			else if (WIFCONTINUED(wstatus))
+				job->state = JOB_RUNNING;
+			else
+			{
+				job->pids[i] = -pid;
+				if (i == job->npids - 1)
+					job->status = decode_status(wstatus);
+				if (!--job->running)
+					job->state = JOB_DONE;
+			}
+			return (job);
+		}
+	return (NULL);
+}
+
+/**
+ * collect_jobs - collects the background children that changed state
+ * since the last call, without blocking; it runs after each command, so
+ * finished ones do not linger as zombies while a script or loop runs
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void collect_jobs(info_t *info)
+{
+	pid_t pid;
+	int wstatus;
+
+	if (!child_pending)
+		return;
+	child_pending = 0;
+	while ((pid = waitpid(-1, &wstatus,
+				WNOHANG | WUNTRACED | WCONTINUED)) > 0)
+		update_job(info, pid, wstatus);
+}
+
+/**
+ * reap_jobs - collects finished background children without blocking,
+ * and in interactive mode reports and forgets the jobs that are done
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void reap_jobs(info_t *info)
+{
+	job_t *job, *next;
+
+	collect_jobs(info);
+	if (!interactive(info))
+		return;
+	for (job = info->jobs; job; job = next)
+	{
+		next = job->next;
+		if (job->state == JOB_DONE)
+		{
+			print_job(job);
+			remove_job(info, job);
+		}
+	}
+}
@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+ * find_job - looks up a job by %n, %%, %+ or by pid
+ * @info: the parameter struct
+ * @spec: the job specification, NULL for the current job
+ *
+ * Return: the job, or NULL if there is no such job
+ */
+job_t *find_job(info_t *info, char *spec)
+{
+	job_t *job, *last = NULL;
+	int i, n;
+
+	for (job = info->jobs; job; job = job->next)
+		last = job;
+	if (!spec || !_strcmp(spec, "%%") || !_strcmp(spec, "%+"))
+		return (last);
+	n = _erratoi(spec[0] == '%' ? spec + 1 : spec);
+	if (n <= 0)
+		return (NULL);
+	for (job = info->jobs; job; job = job->next)
+	{
+		if (spec[0] == '%' && job->id == n)
+			return (job);
+		for (i = 0; spec[0] != '%' && i < job->npids; i++)
+			if (job->pids[i] == n || job->pids[i] == -n)
+				return (job);
+	}
+	return (NULL);
+}
+
+/**
+ * remove_job - unlinks a job from the job table and frees it
+ * @info: the parameter struct
+ * @job: the job to remove
+ *
+ * Return: void
+ */
+void remove_job(info_t *info, job_t *job)
+{
+	job_t **p;
+
+	for (p = &(info->jobs); *p; p = &((*p)->next))
+		if (*p == job)
+		{
+			*p = job->next;
+			free(job->pids);
+			free(job->cmd);
+			free(job);
+			return;
+		}
+}
+
+/**
+ * wait_job - blocks until every process of a job exits or one stops
+ * @info: the parameter struct
+ * @job: the job to wait for
+ *
+ * Return: the job status, the status of its last stage
+ */
+int wait_job(info_t *info, job_t *job)
+{
+	int i, wstatus;
+
+	for (i = 0; i < job->npids && job->state == JOB_RUNNING; i++)
+	{
+		if (job->pids[i] <= 0)
+			continue;
+		if (waitpid(job->pids[i], &wstatus, WUNTRACED) == -1)
+		{
+			if (errno == EINTR)
+			{
+				i--;
+				continue;
+			}
+			wstatus = 0;
+		}
+		update_job(info, job->pids[i], wstatus);
+	}
+	return (job->status);
+}
+
+/**
+ * print_job - prints one line of `jobs` output
+ * @job: the job to print
+ *
+ * Return: void
+ */
+void print_job(job_t *job)
+{
+	char *state[] = {"Running", "Stopped", "Done"};
+
+	_putchar('[');
+	_puts(convert_number(job->id, 10, 0));
+	_puts("]  ");
+	_puts(state[job->state]);
+	if (job->state == JOB_DONE && job->status)
+	{
+		_puts("(");
+		_puts(convert_number(job->status, 10, 0));
+		_puts(")");
+	}
+	_putchar('\t');
+	_puts(job->cmd);
+	_putchar('\n');
+}
+
+/**
+ * set_foreground - hands the terminal to a process group; SIGTTOU is
+ * blocked meanwhile, as the shell may not own the terminal at that point
+ * @info: the parameter and return info struct
+ * @pgid: the process group that should receive terminal input
+ *
+ * Return: void
+ */
+void set_foreground(info_t *info, pid_t pgid)
+{
+	sigset_t set, old;
+
+	if (!info->monitor || pgid <= 0)
+		return;
+	sigemptyset(&set);
+	sigaddset(&set, SIGTTOU);
+	sigprocmask(SIG_BLOCK, &set, &old);
+	tcsetpgrp(STDIN_FILENO, pgid);
+	sigprocmask(SIG_SETMASK, &old, NULL);
+}
+
+/**
+ * kill_job - sends a signal to every process of a job: to its process
+ * group under job control, else to each stage that is still running
+ * @info: the parameter struct
+ * @job: the job
+ * @sig: the signal
+ *
+ * Return: 0 on success, -1 if no process could be signalled
+ */
+int kill_job(info_t *info, job_t *job, int sig)
+{
+	int i, ret = -1;
+
+	if (info->monitor)
+		return (kill(-job->pgid, sig));
+	for (i = 0; i < job->npids; i++)
+		if (job->pids[i] > 0 && !kill(job->pids[i], sig))
+			ret = 0;
+	return (ret);
+}
@@ -0,0 +1,116 @@
+#include "shell.h"
+
+/**
+ * tty_stop - continues a stage that was stopped for reading or setting
+ * the terminal before the shell could hand its process group the terminal
+ * @info: the parameter struct, with the status of the stop
+ * @pid: the stage
+ *
+ * Return: 1 if the stage was continued, 0 if the stop is a real one
+ */
+int tty_stop(info_t *info, pid_t pid)
+{
+	int sig = info->status - 128;
+
+	if (!info->monitor || (sig != SIGTTIN && sig != SIGTTOU) ||
+			tcgetpgrp(STDIN_FILENO) != getpgid(pid))
+		return (0);
+	return (!kill(pid, SIGCONT));
+}
+
+/**
+ * wait_foreground - waits for the stages of a foreground pipeline to
+ * exit, or for one of them to be stopped, e.g. by Ctrl-Z
+ * @info: the parameter struct
+ * @pids: pid of each stage, 0 if it did not start; each one reaped is
+ *        negated
+ * @n: the number of stages
+ *
+ * Return: 1 if a stage was stopped, 0 once all of them are done
+ */
+int wait_foreground(info_t *info, pid_t *pids, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (pids[i] <= 0)
+			continue;
+		while (wait_command(info, pids[i]))
+			if (!tty_stop(info, pids[i]))
+				return (1);
+		pids[i] = -pids[i];
+	}
+	return (0);
+}
+
+/**
+ * stop_job - puts a foreground pipeline that was stopped in the job table,
+ * so fg or bg can continue it, and reports it
+ * @info: the parameter struct
+ * @pids: the stages, as left by wait_foreground()
+ * @n: the number of stages
+ * @cmd: malloc'ed command text, owned by the job
+ *
+ * Return: the job, or NULL on malloc failure
+ */
+job_t *stop_job(info_t *info, pid_t *pids, int n, char *cmd)
+{
+	pid_t *live = malloc(sizeof(pid_t) * n), pgid = 0;
+	job_t *job;
+	int i;
+
+	if (!live)
+		return (free(cmd), NULL);
+	for (i = 0; i < n; i++)
+	{
+		if (!pgid)
+			pgid = pids[i] < 0 ? -pids[i] : pids[i];
+		live[i] = pids[i] > 0 ? pids[i] : 0;
+	}
+	job = add_job(info, live, n, info->status, cmd);
+	if (!job)
+		return (NULL);
+	job->pgid = pgid;
+	job->state = JOB_STOPPED;
+	_putchar('\n');
+	print_job(job);
+	return (job);
+}
+
+/**
+ * job_signals - fills a set with the signals a job must receive with their
+ * default action, whatever the shell does with them
+ * @set: the set to fill
+ *
+ * Return: void
+ */
+void job_signals(sigset_t *set)
+{
+	sigemptyset(set);
+	sigaddset(set, SIGINT);
+	sigaddset(set, SIGTSTP);
+	sigaddset(set, SIGTTIN);
+	sigaddset(set, SIGTTOU);
+}
+
+/**
+ * reset_signals - in a forked child under job control, gives the signals
+ * of job_signals() back their default action, as posix_spawn() does with
+ * POSIX_SPAWN_SETSIGDEF
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void reset_signals(info_t *info)
+{
+	sigset_t set;
+	int sig;
+
+	if (!info->monitor)
+		return;
+	job_signals(&set);
+	for (sig = 1; sig < NSIG; sig++)
+		if (sigismember(&set, sig) == 1)
+			signal(sig, SIG_DFL);
+}
@@ -0,0 +1,136 @@
+#include "shell.h"
+
+/**
+ * lex_fill - reads the next input line into the lexer, prompting with
+ * "> " when a command continues on a new line, or the next line of the
+ * command substitution being run
+ * @lx: the lexer
+ *
+ * Return: 0 on success, 1 at end of input
+ */
+int lex_fill(lexer_t *lx)
+{
+	if (lx->eof)
+		return (1);
+	if (lx->info->source)
+		return (lex_source(lx));
+	if (lx->lines)
+		show_prompt(lx->info, "> ");
+	if (get_input(lx->info) == -1)
+	{
+		lx->eof = 1;
+		return (1);
+	}
+	lx->line = lx->info->arg;
+	lx->pos = 0;
+	lx->lines++;
+	return (0);
+}
+
+/**
+ * lex_copy - copies the first bytes of a string
+ * @s: the string
+ * @n: the number of bytes to copy
+ *
+ * Return: the malloc'ed copy, NUL-terminated
+ */
+char *lex_copy(char *s, size_t n)
+{
+	char *copy = malloc(n + 1);
+
+	if (!copy)
+		return (NULL);
+	memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
+
+/**
+ * lex_operator - recognizes an operator or redirection at the current
+ * position, including the descriptor number of e.g. 2>&1
+ * @lx: the lexer
+ *
+ * Return: 1 if an operator token was read, 0 otherwise
+ */
+int lex_operator(lexer_t *lx)
+{
+	static char * const ops[] = {"&&", "||", ";;", "&", "|", ";", "(", ")",
+		NULL};
+	static const int types[] = {TOK_AND_IF, TOK_OR_IF, TOK_DSEMI, TOK_AMP,
+		TOK_PIPE, TOK_SEMI, TOK_LPAREN, TOK_RPAREN};
+	char *s = lx->line + lx->pos;
+	size_t i = 0;
+
+	while (char_class[(unsigned char)s[i]] & CC_DIGIT)
+		i++;
+	if (s[i] == '<' || s[i] == '>')
+	{
+		if (s[i] == '<' && s[i + 1] == '<')
+			i += 1 + (s[i + 2] == '-' || s[i + 2] == '<');
+		else if ((s[i + 1] == '&' || s[i + 1] == '>') ||
+				(s[i] == '>' && s[i + 1] == '|'))
+			i++;
+		lx->text = arena_copy(&(lx->info->arena), s, ++i);
+		lx->pos += i;
+		return (lx->type = TOK_REDIR, 1);
+	}
+	if (!(char_class[(unsigned char)*s] & CC_META))
+		return (0);
+	for (i = 0; ops[i]; i++)
+		if (starts_with(s, ops[i]))
+		{
+			lx->pos += _strlen(ops[i]);
+			lx->type = types[i];
+			return (1);
+		}
+	return (0);
+}
+
+/**
+ * lex_next - reads the next token, pulling in a new line once the
+ * newline token of the current one has been returned; the bodies of
+ * here-documents on the line are read before its newline token
+ * @lx: the lexer
+ *
+ * Return: the type of the token, also stored in lx->type
+ */
+int lex_next(lexer_t *lx)
+{
+	char *s;
+
+	lx->text = NULL;
+	if (!lx->line && lex_fill(lx))
+		return (lx->type = TOK_EOF);
+	s = lx->line + lx->pos;
+	while (char_class[(unsigned char)*s] & CC_BLANK)
+		s++;
+	if (*s == '#')
+		s += _strlen(s);
+	lx->pos = s - lx->line;
+	if (!*s)
+	{
+		lx->line = NULL;
+		if (lx->nheredocs && lex_heredocs(lx))
+			return (lx->eof = 1, lx->type = TOK_EOF);
+		return (lx->type = TOK_NEWLINE);
+	}
+	if (lex_operator(lx))
+		return (lx->type);
+	return (lex_word(lx));
+}
+
+/**
+ * tok_name - names the current token for a syntax error message
+ * @lx: the lexer
+ *
+ * Return: the token text
+ */
+char *tok_name(lexer_t *lx)
+{
+	static char * const names[] = {"", "newline", "end of file", ";", "&",
+		"|", "&&", "||", "", "(", ")", ";;"};
+
+	if (lx->text)
+		return (lx->text);
+	return (names[lx->type]);
+}
@@ -0,0 +1,98 @@
+#include "shell.h"
+
+/**
+ * lex_scan - finds where a word ends on the current line, stepping over
+ * quoted text, backslash escapes, ${...} forms and command substitutions,
+ * which are kept for
+ * expansion; it jumps from one special byte to the next with cc_next()
+ * @s: the rest of the word
+ * @quote: the open quote character, 0 if none; updated
+ * @cont: set on if the line ends in an unquoted backslash, which joins
+ *        it to the next line
+ *
+ * Return: the number of bytes that belong to the word, without the
+ *         joining backslash
+ */
+size_t lex_scan(char *s, char *quote, int *cont)
+{
+	char *p = s, *end;
+
+	*cont = 0;
+	while (1)
+	{
+		if (*quote == '\'')
+		{
+			p = strchr(p, '\'');
+			if (!p)
+				return (_strlen(s));
+			*quote = 0;
+			p++;
+			continue;
+		}
+		p = cc_next(p);
+		if (!*p)
+			return (p - s);
+		if (!*quote && char_class[(unsigned char)*p] & (CC_BLANK | CC_META))
+			return (p - s);
+		if (*p == '\\' && !p[1])
+			return (*cont = 1, p - s);
+		end = *p == '$' && p[1] == '{' ? skip_brace(p + 2) : skip_subst(p);
+		if (end)
+		{
+			p = end + 1;
+			continue;
+		}
+		if (*p == '\\')
+			p++;
+		else if (*quote)
+			*quote = *p == '"' ? 0 : *quote;
+		else if (*p == '\'' || *p == '"')
+			*quote = *p;
+		p++;
+	}
+}
+
+/**
+ * lex_word - reads a word token, pulling in more lines while a quote is
+ * open or a line ends in a backslash; the word is copied in one pass
+ * into the arena, quotes and all
+ * @lx: the lexer, on the first byte of the word
+ *
+ * Return: TOK_WORD, or TOK_EOF if input ends inside quotes
+ */
+int lex_word(lexer_t *lx)
+{
+	char quote = 0, *s, *word = NULL;
+	size_t n, len = 0, size = 0;
+	int cont;
+
+	while (1)
+	{
+		s = lx->line + lx->pos;
+		n = lex_scan(s, &quote, &cont);
+		word = arena_grow(&(lx->info->arena), word, size, len + n + 2);
+		if (!word)
+			return (lx->eof = 1, lx->type = TOK_EOF);
+		size = len + n + 2;
+		memcpy(word + len, s, n);
+		len += n;
+		lx->pos += n + cont;
+		if (!quote && !cont)
+			break;
+		if (quote)
+			word[len++] = '\n';
+		if (lex_fill(lx))
+		{
+			lx->line = "";
+			lx->pos = 0;
+			if (!quote)
+				break;
+			lx->type = TOK_EOF;
+			parse_error(lx);
+			return (TOK_EOF);
+		}
+	}
+	word[len] = '\0';
+	lx->text = word;
+	return (lx->type = TOK_WORD);
+}
@@ -17,9 +17,11 @@ int main(int ac, char **av)
          : "=r" (fd)
          : "r" (fd));
 
+    _strcpy(info->pid, convert_number(getpid(), 10, 0));
+
     if (ac == 2)
     {
-        fd = open(av[1], O_RDONLY);
+        fd = open(av[1], O_RDONLY | O_CLOEXEC);
         if (fd == -1)
         {
             if (errno == EACCES)
@@ -36,9 +38,12 @@ int main(int ac, char **av)
             return (EXIT_FAILURE);
         }
         info->readfd = fd;
+        script_open(info);
     }
     populate_env_list(info);
-    read_history(info);
-    hsh(info, av);
+    init_jobs(info);
+    if (interactive(info))
+        read_history(info);
+    mainShellLoop(info, av);
     return (EXIT_SUCCESS);
 }
@@ -0,0 +1,144 @@
+#include "shell.h"
+
+/**
+ * parse_command - reads and parses one complete command: a list ending
+ * at a newline that is not inside an unfinished construct
+ * @info: the parameter struct
+ * @tree: receives the syntax tree, NULL for a blank line or on error
+ *
+ * Return: 0 on success, -1 at end of input or, when not interactive,
+ *         after a syntax error
+ */
+int parse_command(info_t *info, node_t **tree)
+{
+	lexer_t lx = {NULL, NULL, 0, TOK_NEWLINE, NULL, 0, 0, 0, NULL, 0};
+
+	lx.info = info;
+	*tree = NULL;
+	if (lex_next(&lx) == TOK_EOF)
+		return (-1);
+	if (lx.type != TOK_NEWLINE)
+		*tree = parse_list(&lx, 0);
+	if (*tree && lx.type != TOK_NEWLINE)
+		parse_error(&lx);
+	if (!lx.error)
+		return (0);
+	*tree = NULL;
+	return (interactive(info) ? 0 : -1);
+}
+
+/**
+ * parse_list - parses and-or lists separated by ';' or '&', the latter
+ * running the and-or list before it in the background
+ * @lx: the lexer, on the first token of the list
+ * @nested: on for the body of a compound command, where newlines also
+ *          separate and-or lists and a closing reserved word ends them
+ *
+ * Return: the list, or NULL on error
+ */
+node_t *parse_list(lexer_t *lx, int nested)
+{
+	node_t *list, *node, **last = &list;
+
+	while (nested && lx->type == TOK_NEWLINE)
+		lex_next(lx);
+	list = parse_and_or(lx);
+	while (list && (lx->type == TOK_SEMI || lx->type == TOK_AMP ||
+				(nested && lx->type == TOK_NEWLINE)))
+	{
+		if (lx->type == TOK_AMP)
+			*last = new_node(lx, NODE_BG, *last, NULL);
+		if (!*last)
+			return (NULL);
+		lex_next(lx);
+		while (nested && lx->type == TOK_NEWLINE)
+			lex_next(lx);
+		if (list_end(lx, nested))
+			break;
+		node = parse_and_or(lx);
+		if (!node)
+			return (NULL);
+		*last = new_node(lx, NODE_SEQ, *last, node);
+		if (!*last)
+			return (NULL);
+		last = &((*last)->right);
+	}
+	return (list);
+}
+
+/**
+ * parse_and_or - parses pipelines joined by && and ||, which group
+ * from the left
+ * @lx: the lexer
+ *
+ * Return: the and-or list, or NULL on error
+ */
+node_t *parse_and_or(lexer_t *lx)
+{
+	node_t *left, *right;
+	int type;
+
+	left = parse_pipeline(lx);
+	while (left && (lx->type == TOK_AND_IF || lx->type == TOK_OR_IF))
+	{
+		type = lx->type == TOK_AND_IF ? NODE_AND : NODE_OR;
+		lex_linebreak(lx);
+		right = parse_pipeline(lx);
+		if (!right)
+			return (NULL);
+		left = new_node(lx, type, left, right);
+	}
+	return (left);
+}
+
+/**
+ * parse_pipeline - parses commands joined by '|'
+ * @lx: the lexer
+ *
+ * Return: the command, a NODE_PIPE chain of them, or NULL on error
+ */
+node_t *parse_pipeline(lexer_t *lx)
+{
+	node_t *cmd, *rest;
+
+	cmd = parse_compound(lx);
+	if (!cmd || lx->type != TOK_PIPE)
+		return (cmd);
+	lex_linebreak(lx);
+	rest = parse_pipeline(lx);
+	if (!rest)
+		return (NULL);
+	return (new_node(lx, NODE_PIPE, cmd, rest));
+}
+
+/**
+ * parse_simple - parses a simple command: words and redirections in
+ * any order, kept as written for expansion when the command runs
+ * @lx: the lexer
+ *
+ * Return: the NODE_CMD node, or NULL on error
+ */
+node_t *parse_simple(lexer_t *lx)
+{
+	node_t *cmd;
+
+	if ((lx->type != TOK_WORD && lx->type != TOK_REDIR) ||
+			(lx->type == TOK_WORD && is_reserved(lx->text)))
+		return (parse_error(lx), NULL);
+	cmd = new_node(lx, NODE_CMD, NULL, NULL);
+	if (!cmd)
+		return (NULL);
+	cmd->line = lx->info->input_line;
+	while (lx->type == TOK_WORD || lx->type == TOK_REDIR)
+	{
+		if (lx->type == TOK_REDIR)
+		{
+			if (parse_redirect(lx, cmd))
+				return (NULL);
+		}
+		else if (add_word(lx, cmd, lx->text))
+			return (NULL);
+		lex_next(lx);
+	}
+	return (cmd);
+}
@@ -0,0 +1,89 @@
+#include "shell.h"
+
+/**
+ * parse_error - reports the current token as unexpected, once per command
+ * @lx: the lexer
+ *
+ * Return: void
+ */
+void parse_error(lexer_t *lx)
+{
+	if (lx->error)
+		return;
+	lx->error = 1;
+	lx->info->line_count = lx->info->input_line;
+	print_syntax_error(lx->info, tok_name(lx));
+}
+
+/**
+ * lex_linebreak - moves past an operator that may be followed by
+ * newlines, as in `a &&` at the end of a line
+ * @lx: the lexer
+ *
+ * Return: void
+ */
+void lex_linebreak(lexer_t *lx)
+{
+	while (lex_next(lx) == TOK_NEWLINE)
+		;
+}
+
+/**
+ * parse_redirect - parses a redirection operator and its target word
+ * into the command's redirection list
+ * @lx: the lexer, on the TOK_REDIR token
+ * @cmd: the command node
+ *
+ * Return: 0 on success, 1 on error, the lexer left on the target
+ */
+int parse_redirect(lexer_t *lx, node_t *cmd)
+{
+	redir_t r, *node, **tail = &(cmd->redirs);
+	char *op = lx->text;
+
+	if (lex_next(lx) != TOK_WORD || parse_redir(op, lx->text, &r) != 2)
+	{
+		parse_error(lx);
+		return (1);
+	}
+	node = arena_alloc(&(lx->info->arena), sizeof(redir_t));
+	if (!node)
+		return (1);
+	*node = r;
+	while (*tail)
+		tail = &((*tail)->next);
+	*tail = node;
+	if (r.flags == REDIR_HEREDOC || r.flags == REDIR_HERE_TAB)
+		return (lex_pending(lx, node));
+	return (0);
+}
+
+/**
+ * is_word - checks if the current token is a given unquoted word
+ * @lx: the lexer
+ * @word: the word, e.g. a reserved word such as "then"
+ *
+ * Return: 1 if it is, 0 otherwise
+ */
+int is_word(lexer_t *lx, char *word)
+{
+	return (lx->type == TOK_WORD && !_strcmp(lx->text, word));
+}
+
+/**
+ * parse_expect - moves past a reserved word the grammar requires here
+ * @lx: the lexer
+ * @word: the reserved word
+ *
+ * Return: 0 on success, 1 on a syntax error
+ */
+int parse_expect(lexer_t *lx, char *word)
+{
+	if (!is_word(lx, word))
+	{
+		parse_error(lx);
+		return (1);
+	}
+	lex_next(lx);
+	return (0);
+}
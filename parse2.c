@@ -0,0 +1,131 @@
+#include "shell.h"
+
+/**
+ * is_reserved - checks if a word is reserved where a command may start
+ * @word: the word
+ *
+ * Return: 1 if it is, 0 otherwise
+ */
+int is_reserved(char *word)
+{
+	static char * const words[] = {"if", "then", "elif", "else", "fi",
+		"while", "until", "for", "do", "done", "case", "esac", NULL};
+	int i;
+
+	for (i = 0; words[i]; i++)
+		if (!_strcmp(word, words[i]))
+			return (1);
+	return (0);
+}
+
+/**
+ * list_end - checks if the current token ends a list
+ * @lx: the lexer, just past a separator
+ * @nested: on inside a compound command
+ *
+ * Return: 1 if it does, 0 if another and-or list follows
+ */
+int list_end(lexer_t *lx, int nested)
+{
+	static char * const ends[] = {"then", "elif", "else", "fi", "do",
+		"done", "esac", NULL};
+	int i;
+
+	if (lx->type == TOK_NEWLINE || lx->type == TOK_EOF)
+		return (1);
+	if (!nested)
+		return (0);
+	if (lx->type == TOK_RPAREN || lx->type == TOK_DSEMI)
+		return (1);
+	for (i = 0; ends[i]; i++)
+		if (is_word(lx, ends[i]))
+			return (1);
+	return (0);
+}
+
+/**
+ * parse_compound - parses a command: a compound command, followed by
+ * any redirections, or a simple command
+ * @lx: the lexer
+ *
+ * Return: the command, or NULL on error
+ */
+node_t *parse_compound(lexer_t *lx)
+{
+	node_t *node;
+	unsigned int line = lx->info->input_line;
+
+	if (is_word(lx, "if"))
+		node = parse_if(lx);
+	else if (is_word(lx, "while") || is_word(lx, "until"))
+		node = parse_loop(lx);
+	else if (is_word(lx, "for"))
+		node = parse_for(lx);
+	else if (is_word(lx, "case"))
+		node = parse_case(lx);
+	else
+		return (parse_simple(lx));
+	if (node)
+		node->line = line;
+	while (node && lx->type == TOK_REDIR)
+	{
+		if (parse_redirect(lx, node))
+			return (NULL);
+		lex_next(lx);
+	}
+	return (node);
+}
+
+/**
+ * parse_if - parses `if list; then list; [elif ...;] [else list;] fi`,
+ * an elif being parsed as the else part holding another if
+ * @lx: the lexer, on the "if" or "elif"
+ *
+ * Return: the NODE_IF node, or NULL on error
+ */
+node_t *parse_if(lexer_t *lx)
+{
+	node_t *cond, *body, *rest = NULL, *node;
+
+	lex_next(lx);
+	cond = parse_list(lx, 1);
+	if (!cond || parse_expect(lx, "then"))
+		return (NULL);
+	body = parse_list(lx, 1);
+	if (body && is_word(lx, "elif"))
+		rest = parse_if(lx);
+	else if (body && is_word(lx, "else"))
+	{
+		lex_next(lx);
+		rest = parse_list(lx, 1);
+		if (rest && parse_expect(lx, "fi"))
+			rest = NULL;
+	}
+	else if (body && parse_expect(lx, "fi"))
+		body = NULL;
+	if (!body || (!rest && lx->error))
+		return (NULL);
+	node = new_node(lx, NODE_IF, cond, body);
+	if (!node)
+		return (NULL);
+	node->next = rest;
+	return (node);
+}
+
+/**
+ * parse_do_group - parses the `do list; done` body of a loop
+ * @lx: the lexer, on the "do"
+ *
+ * Return: the body, or NULL on error
+ */
+node_t *parse_do_group(lexer_t *lx)
+{
+	node_t *body;
+
+	if (parse_expect(lx, "do"))
+		return (NULL);
+	body = parse_list(lx, 1);
+	if (body && parse_expect(lx, "done"))
+		return (NULL);
+	return (body);
+}
@@ -0,0 +1,127 @@
+#include "shell.h"
+
+/**
+ * parse_loop - parses `while list; do list; done` and the until form
+ * @lx: the lexer, on the "while" or "until"
+ *
+ * Return: the NODE_WHILE or NODE_UNTIL node, or NULL on error
+ */
+node_t *parse_loop(lexer_t *lx)
+{
+	node_t *cond, *body;
+	int type = is_word(lx, "while") ? NODE_WHILE : NODE_UNTIL;
+
+	lex_next(lx);
+	cond = parse_list(lx, 1);
+	if (!cond)
+		return (NULL);
+	body = parse_do_group(lx);
+	if (!body)
+		return (NULL);
+	return (new_node(lx, type, cond, body));
+}
+
+/**
+ * parse_for - parses `for name [in word...]; do list; done`
+ * @lx: the lexer, on the "for"
+ *
+ * Return: the NODE_FOR node, or NULL on error
+ */
+node_t *parse_for(lexer_t *lx)
+{
+	node_t *node;
+
+	if (lex_next(lx) != TOK_WORD || !is_name(lx->text))
+		return (parse_error(lx), NULL);
+	node = new_node(lx, NODE_FOR, NULL, NULL);
+	if (!node || add_word(lx, node, lx->text))
+		return (NULL);
+	while (lex_next(lx) == TOK_NEWLINE)
+		;
+	if (is_word(lx, "in"))
+	{
+		while (lex_next(lx) == TOK_WORD)
+			if (add_word(lx, node, lx->text))
+				return (NULL);
+		if (lx->type != TOK_SEMI && lx->type != TOK_NEWLINE)
+			return (parse_error(lx), NULL);
+		lex_next(lx);
+	}
+	else if (lx->type == TOK_SEMI)
+		lex_next(lx);
+	while (lx->type == TOK_NEWLINE)
+		lex_next(lx);
+	node->left = parse_do_group(lx);
+	if (!node->left)
+		return (NULL);
+	return (node);
+}
+
+/**
+ * parse_case_item - parses `[(] pattern [| pattern...]) [list] [;;]`
+ * @lx: the lexer, on the first token of the item
+ *
+ * Return: the NODE_ITEM node, or NULL on error
+ */
+node_t *parse_case_item(lexer_t *lx)
+{
+	node_t *item = new_node(lx, NODE_ITEM, NULL, NULL);
+
+	if (!item)
+		return (NULL);
+	if (lx->type == TOK_LPAREN)
+		lex_next(lx);
+	while (lx->type == TOK_WORD && !add_word(lx, item, lx->text))
+	{
+		if (lex_next(lx) != TOK_PIPE)
+			break;
+		lex_next(lx);
+	}
+	if (!item->nwords || lx->type != TOK_RPAREN)
+		return (parse_error(lx), NULL);
+	while (lex_next(lx) == TOK_NEWLINE)
+		;
+	if (lx->type != TOK_DSEMI && !is_word(lx, "esac"))
+	{
+		item->left = parse_list(lx, 1);
+		if (!item->left)
+			return (NULL);
+	}
+	if (lx->type == TOK_DSEMI)
+		while (lex_next(lx) == TOK_NEWLINE)
+			;
+	else if (!is_word(lx, "esac"))
+		return (parse_error(lx), NULL);
+	return (item);
+}
+
+/**
+ * parse_case - parses `case word in [item...] esac`
+ * @lx: the lexer, on the "case"
+ *
+ * Return: the NODE_CASE node, or NULL on error
+ */
+node_t *parse_case(lexer_t *lx)
+{
+	node_t *node, **tail;
+
+	if (lex_next(lx) != TOK_WORD)
+		return (parse_error(lx), NULL);
+	node = new_node(lx, NODE_CASE, NULL, NULL);
+	if (!node || add_word(lx, node, lx->text))
+		return (NULL);
+	while (lex_next(lx) == TOK_NEWLINE)
+		;
+	if (parse_expect(lx, "in"))
+		return (NULL);
+	while (lx->type == TOK_NEWLINE)
+		lex_next(lx);
+	for (tail = &(node->left); !is_word(lx, "esac"); tail = &((*tail)->right))
+	{
+		*tail = parse_case_item(lx);
+		if (!*tail)
+			return (NULL);
+	}
+	lex_next(lx);
+	return (node);
+}
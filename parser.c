@@ -43,25 +43,18 @@ char *duplicateChars(char *pathstr, int start, int stop)
 }
 
 /**
- * findPath - finds this cmd in the PATH string
+ * searchPath - walks the PATH string looking for cmd
  * @info: the info struct
  * @pathstr: the PATH string
  * @cmd: the cmd to find
  *
  * Return: full path of cmd if found or NULL
  */
-char *findPath(info_t *info, char *pathstr, char *cmd)
+char *searchPath(info_t *info, char *pathstr, char *cmd)
 {
 	int i = 0, curr_pos = 0;
 	char *path;
 
-	if (!pathstr)
-		return (NULL);
-	if ((_strlen(cmd) > 2) && startsWith(cmd, "./"))
-	{
-		if (isCommand(info, cmd))
-			return (cmd);
-	}
 	while (1)
 	{
 		if (!pathstr[i] || pathstr[i] == ':')
@@ -84,3 +77,48 @@ char *findPath(info_t *info, char *pathstr, char *cmd)
 	}
 	return (NULL);
 }
+
+/**
+ * findPath - finds this cmd in the PATH string, consulting the
+ * resolved command table first so PATH is only walked once per name;
+ * a remembered path that is no longer a file is forgotten and PATH
+ * searched again, and a failed search is not remembered, so a command
+ * installed later is found
+ * @info: the info struct
+ * @pathstr: the PATH string
+ * @cmd: the cmd to find
+ *
+ * Return: full path of cmd if found or NULL
+ */
+char *findPath(info_t *info, char *pathstr, char *cmd)
+{
+	cmdhash_t *entry;
+	char *path;
+
+	if (!pathstr)
+		return (NULL);
+	if ((_strlen(cmd) > 2) && starts_with(cmd, "./"))
+	{
+		if (isCommand(info, cmd))
+			return (cmd);
+	}
+	if (_strchr(cmd, '/'))
+		return (NULL);
+	entry = hash_find(info, cmd);
+	if (entry && !isCommand(info, entry->path))
+	{
+		hash_forget(info, cmd);
+		entry = NULL;
+	}
+	if (!entry)
+	{
+		path = searchPath(info, pathstr, cmd);
+		if (!path)
+			return (NULL);
+		entry = hash_add(info, cmd, path);
+		if (!entry)
+			return (path);
+	}
+	entry->hits++;
+	return (entry->path);
+}
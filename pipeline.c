@@ -0,0 +1,231 @@
+#include "shell.h"
+
+/**
+ * spawn_stage - spawns an external pipeline stage on the given fds
+ * @info: the parameter and return info struct
+ * @in: fd to use as the stage's stdin
+ * @out: fd to use as the stage's stdout
+ * @pgid: process group to join, 0 to lead a new one; only under job
+ *        control, else the stage stays in the shell's group
+ *
+ * Under job control the stage also gets the default action for the
+ * signals of job_signals(). With USE_SPAWN 0 it is started with
+ * fork_command() instead.
+ *
+ * Return: pid of the stage, or -1 on failure
+ */
+pid_t spawn_stage(info_t *info, int in, int out, pid_t pgid)
+{
+#if USE_SPAWN
+	posix_spawn_file_actions_t actions;
+	posix_spawnattr_t attr;
+	sigset_t sigdef;
+	pid_t pid;
+
+	posix_spawn_file_actions_init(&actions);
+	posix_spawnattr_init(&attr);
+	if (in != STDIN_FILENO)
+		posix_spawn_file_actions_adddup2(&actions, in, STDIN_FILENO);
+	if (out != STDOUT_FILENO)
+		posix_spawn_file_actions_adddup2(&actions, out, STDOUT_FILENO);
+	redir_actions(info, &actions);
+	if (info->monitor)
+	{
+		job_signals(&sigdef);
+		posix_spawnattr_setsigdefault(&attr, &sigdef);
+		posix_spawnattr_setpgroup(&attr, pgid);
+		posix_spawnattr_setflags(&attr,
+				POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGDEF);
+	}
+	pid = spawn_command(info, &actions, &attr);
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&actions);
+	return (pid);
+#else
+	return (fork_command(info, in, out, pgid));
+#endif
+}
+
+/**
+ * fork_stage - runs a builtin or compound pipeline stage in a forked child
+ * @info: the parameter and return info struct
+ * @node: the stage to evaluate, or NULL to run the builtin in info->argv
+ * @in: fd to use as the stage's stdin
+ * @out: fd to use as the stage's stdout
+ * @pgid: process group to join, 0 to lead a new one, as for spawn_stage()
+ *
+ * Return: pid of the stage in the parent, or -1 on failure
+ */
+pid_t fork_stage(info_t *info, node_t *node, int in, int out, pid_t pgid)
+{
+	pid_t pid;
+	int ret;
+
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	pid = fork();
+	if (pid == -1)
+	{
+		perror("Error:");
+		return (-1);
+	}
+	if (pid)
+	{
+		if (info->monitor)
+			setpgid(pid, pgid ? pgid : pid);
+		return (pid);
+	}
+	if (info->monitor)
+		setpgid(0, pgid);
+	reset_signals(info);
+	info->monitor = 0;
+	if (in != STDIN_FILENO)
+		dup2(in, STDIN_FILENO);
+	if (out != STDOUT_FILENO)
+		dup2(out, STDOUT_FILENO);
+	ret = node ? eval_node(info, node) : findBuiltin(info);
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	if (ret == -2)
+		exit(info->err_num == -1 ? info->status : info->err_num);
+	exit(info->status);
+}
+
+/**
+ * start_stage - expands one stage and starts it without waiting
+ * @info: the parameter and return info struct
+ * @node: the stage
+ * @in: fd to use as the stage's stdin
+ * @out: fd to use as the stage's stdout
+ * @pgid: process group to join, 0 to lead a new one
+ *
+ * Return: pid of the stage, or 0 with info->status set if none started;
+ *         an expansion error only fails the stage, as in a subshell
+ */
+pid_t start_stage(info_t *info, node_t *node, int in, int out, pid_t pgid)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	pid_t pid = 0;
+
+	if (node->type != NODE_CMD)
+		pid = fork_stage(info, node, in, out, pgid);
+	else if (set_command(info, node))
+		info->status = 1;
+	else if (open_redirs(info))
+		info->status = 1;
+	else if (!*info->argv[0])
+		info->status = info->subst_status;
+	else if (getBuiltin(info->argv[0]))
+		pid = fork_stage(info, NULL, in, out, pgid);
+	else
+	{
+		info->path = findPath(info, _getenv(info, "PATH="), info->argv[0]);
+		if (!info->path && isCommand(info, info->argv[0]))
+			info->path = info->argv[0];
+		if (info->path)
+			pid = spawn_stage(info, in, out, pgid);
+		else
+		{
+			info->status = 127;
+			print_error(info, "not found\n");
+		}
+	}
+	if (info->skip == SKIP_ERROR)
+	{
+		info->skip = 0;
+		info->status = 2;
+	}
+	free_info(info, 0);
+	arena_release(&(info->arena), mark);
+	return (pid > 0 ? pid : 0);
+}
+
+/**
+ * start_pipeline - starts every stage, wiring each stdout to the next
+ * stage's stdin, without waiting for any of them
+ * @info: the parameter and return info struct
+ * @stages: the stages
+ * @pids: array receiving the pid of each stage, 0 if it did not start
+ * @n: the number of stages
+ *
+ * Return: the number of stages that were attempted
+ */
+int start_pipeline(info_t *info, node_t **stages, pid_t *pids, int n)
+{
+	pid_t pgid = 0;
+	int i, in = STDIN_FILENO, fds[2];
+
+	if (info->background && !info->monitor)
+		in = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	for (i = 0; i < n; i++)
+	{
+		fds[1] = STDOUT_FILENO;
+		if (i < n - 1 && pipe2(fds, O_CLOEXEC) == -1)
+		{
+			perror("Error:");
+			break;
+		}
+		pids[i] = start_stage(info, stages[i], in == -1 ? STDIN_FILENO : in,
+				fds[1], pgid);
+		if (!pgid && pids[i])
+			pgid = pids[i];
+		if (pgid == pids[i] && !info->background)
+			set_foreground(info, pgid);
+		if (in > STDIN_FILENO)
+			close(in);
+		in = i < n - 1 ? (close(fds[1]), fds[0]) : STDIN_FILENO;
+	}
+	if (in > STDIN_FILENO)
+		close(in);
+	return (i);
+}
+
+/**
+ * run_pipeline - runs `a | b | ...` with every stage started at once in
+ * one process group, then waits for all of them, or until one is
+ * stopped. A command run in the background goes through here as well,
+ * but is put in the job table
+ * @info: the parameter and return info struct
+ * @node: the pipeline, or the single command or list to run
+ * @background: on to add the pipeline to the job table and not wait
+ *
+ * Return: the pipeline status, which is the status of the last stage
+ */
+int run_pipeline(info_t *info, node_t *node, int background)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	node_t **stages, *p;
+	pid_t *pids;
+	int i, n, status;
+
+	for (n = 1, p = node; p->type == NODE_PIPE; p = p->right)
+		n++;
+	stages = arena_alloc(&(info->arena), sizeof(node_t *) * n);
+	pids = background ? malloc(sizeof(pid_t) * n) :
+		arena_alloc(&(info->arena), sizeof(pid_t) * n);
+	if (!stages || !pids)
+	{
+		perror("Error:");
+		if (background)
+			free(pids);
+		arena_release(&(info->arena), mark);
+		return (info->status = 1);
+	}
+	for (i = 0, p = node; p->type == NODE_PIPE; p = p->right)
+		stages[i++] = p->left;
+	stages[i] = p;
+	info->background = background;
+	n = start_pipeline(info, stages, pids, n);
+	status = info->status;
+	if (background)
+		add_job(info, pids, n, status, node_text(node));
+	else if (wait_foreground(info, pids, n))
+		stop_job(info, pids, n, node_text(node));
+	else if (n && !pids[n - 1])
+		info->status = status;
+	info->background = 0;
+	set_foreground(info, getpgrp());
+	collect_jobs(info);
+	arena_release(&(info->arena), mark);
+	return (background ? (info->status = 0) : info->status);
+}
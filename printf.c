@@ -0,0 +1,143 @@
+#include "shell.h"
+
+/**
+ * print_escape - prints the character a backslash escape stands for
+ * @s: points just past the backslash
+ * @stop: set to 1 when \c asks for the output to stop
+ *
+ * Return: the number of characters consumed after the backslash
+ */
+int print_escape(char *s, int *stop)
+{
+	static char map[] = "\\\\a\ab\be\033f\fn\nr\rt\tv\v";
+	int i, n = 0, val = 0;
+
+	if (*s == 'c')
+		return (*stop = 1);
+	for (i = 0; map[i]; i += 2)
+		if (*s == map[i])
+			return (_putchar(map[i + 1]));
+	if (*s == '0')
+		n++;
+	for (i = 0; i < 3 && s[n] >= '0' && s[n] <= '7'; i++, n++)
+		val = val * 8 + s[n] - '0';
+	_putchar(n ? val : '\\');
+	return (n);
+}
+
+/**
+ * print_escapes - prints a string, interpreting backslash escapes
+ * @s: the string
+ * @stop: set to 1 if a \c escape was seen
+ *
+ * Return: void
+ */
+void print_escapes(char *s, int *stop)
+{
+	for (; *s && !*stop; s++)
+	{
+		if (*s == '\\')
+			s += print_escape(s + 1, stop);
+		else
+			_putchar(*s);
+	}
+}
+
+/**
+ * put_formatted - formats like snprintf() into the stdout buffer
+ * @fmt: a single printf conversion, e.g. "%-5ld"
+ *
+ * Return: number of characters written, -1 on malloc failure
+ */
+int put_formatted(const char *fmt, ...)
+{
+	va_list ap;
+	char buf[1024], *p = buf;
+	int i, n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+	if (n >= (int)sizeof(buf))
+	{
+		p = malloc(n + 1);
+		if (!p)
+			return (-1);
+		va_start(ap, fmt);
+		vsnprintf(p, n + 1, fmt, ap);
+		va_end(ap);
+	}
+	for (i = 0; i < n; i++)
+		_putchar(p[i]);
+	if (p != buf)
+		free(p);
+	return (n);
+}
+
+/**
+ * printf_conv - prints one %-conversion of the printf builtin
+ * @info: the parameter struct, for error messages
+ * @spec: the conversion, checked by printf_spec()
+ * @arg: the argument for it, NULL once the arguments ran out
+ * @stop: set to 1 if a %b argument contained \c
+ *
+ * Return: 0 on success, 1 if arg is not a valid number or out of range
+ */
+int printf_conv(info_t *info, char *spec, char *arg, int *stop)
+{
+	char cbuf[2];
+	int k = _strlen(spec);
+
+	if (spec[k - 1] == 'b')
+		return (print_escapes(arg ? arg : "", stop), 0);
+	if (spec[k - 1] == 's' || spec[k - 1] == 'c')
+	{
+		cbuf[0] = arg ? arg[0] : '\0';
+		cbuf[1] = '\0';
+		if (spec[k - 1] == 'c')
+			arg = cbuf, spec[k - 1] = 's';
+		return (put_formatted(spec, arg ? arg : ""), 0);
+	}
+	return (printf_number(info, spec, arg));
+}
+
+/**
+ * printf_format - prints the format string once, taking arguments
+ * from *args as conversions need them
+ * @info: the parameter struct, for error messages
+ * @fmt: the format string
+ * @args: address of the pointer to the next unused argument
+ * @stop: set to 1 when \c asks for the output to stop
+ *
+ * Return: 0 on success, 1 if any conversion failed
+ */
+int printf_format(info_t *info, char *fmt, char ***args, int *stop)
+{
+	char spec[64];
+	int i, k, ret = 0;
+
+	for (i = 0; fmt[i] && !*stop; i++)
+	{
+		if (fmt[i] == '\\')
+			i += print_escape(fmt + i + 1, stop);
+		else if (fmt[i] != '%')
+			_putchar(fmt[i]);
+		else if (fmt[i + 1] == '%')
+			_putchar(fmt[i++]);
+		else
+		{
+			k = printf_spec(info, fmt + i, spec, args, &ret);
+			if (!k)
+			{
+				print_error(info, spec);
+				_eputs(": invalid directive\n");
+				return (1);
+			}
+			i += k - 1;
+			ret |= printf_conv(info, spec, **args, stop);
+			if (**args)
+				(*args)++;
+		}
+	}
+	return (ret);
+}
@@ -0,0 +1,175 @@
+#include "shell.h"
+
+/**
+ * printf_bad - reports a printf argument that strtol() and friends could
+ * not convert whole, or that was out of range; errno must be cleared
+ * before the conversion
+ * @info: the parameter struct, for error messages
+ * @arg: the argument, NULL if there was none
+ * @end: where the conversion stopped
+ *
+ * Return: 0 if arg was fine, 1 if an error was printed
+ */
+int printf_bad(info_t *info, char *arg, char *end)
+{
+	if (!arg)
+		return (0);
+	if (*end || !*arg)
+	{
+		print_error(info, arg);
+		_eputs(": invalid number\n");
+		return (1);
+	}
+	if (errno != ERANGE)
+		return (0);
+	print_error(info, arg);
+	_eputs(": Numerical result out of range\n");
+	return (1);
+}
+
+/**
+ * printf_star - takes the width or precision a '*' stands for from the
+ * arguments and appends it to a conversion as digits; a value an int
+ * cannot hold is out of range and is clamped
+ * @info: the parameter struct, for error messages
+ * @spec: the conversion being built
+ * @k: the length of spec, updated
+ * @args: address of the pointer to the next unused argument
+ *
+ * Return: 0 on success, 1 if the argument is not a valid number or is
+ *         out of range
+ */
+int printf_star(info_t *info, char *spec, int *k, char ***args)
+{
+	char *arg = **args, *end = "", *digits;
+	long n = 0;
+
+	errno = 0;
+	if (arg)
+	{
+		n = strtol(arg, &end, 0);
+		(*args)++;
+	}
+	if (n > INT_MAX || n < -INT_MAX)
+	{
+		errno = ERANGE;
+		n = n > 0 ? INT_MAX : -INT_MAX;
+	}
+	if (spec[*k - 1] == '.' && n < 0)
+		(*k)--;
+	else
+	{
+		digits = convert_number(n, 10, 0);
+		_strcpy(spec + *k, digits);
+		*k += _strlen(digits);
+	}
+	return (printf_bad(info, arg, end));
+}
+
+/**
+ * printf_width - copies the width or precision of a conversion, digits
+ * or a '*' taken from the arguments; a negative precision means none
+ * @info: the parameter struct, for error messages
+ * @fmt: the format, where the width or precision may start
+ * @spec: the conversion being built
+ * @k: the length of spec, updated
+ * @args: address of the pointer to the next unused argument
+ * @bad: set to 1 if a '*' argument is not a valid number
+ *
+ * Return: the number of characters of fmt used, -1 if there are too many
+ *         digits
+ */
+int printf_width(info_t *info, char *fmt, char *spec, int *k, char ***args,
+		int *bad)
+{
+	int i;
+
+	if (*fmt == '*')
+	{
+		*bad |= printf_star(info, spec, k, args);
+		return (1);
+	}
+	for (i = 0; fmt[i] >= '0' && fmt[i] <= '9'; i++)
+	{
+		if (i == 9)
+			return (-1);
+		spec[(*k)++] = fmt[i];
+	}
+	return (i);
+}
+
+/**
+ * printf_spec - checks one %-conversion of a printf format, which may
+ * have the flags "-+ #0", a width and a precision but no length, and
+ * copies it with each '*' replaced by its argument
+ * @info: the parameter struct, for error messages
+ * @fmt: the format, at the '%'
+ * @spec: receives the conversion, or the part of it up to the first
+ *        character not allowed; at least 64 bytes
+ * @args: address of the pointer to the next unused argument
+ * @bad: set to 1 if a '*' argument is not a valid number
+ *
+ * Return: the length of the conversion in fmt, 0 if it is invalid
+ */
+int printf_spec(info_t *info, char *fmt, char *spec, char ***args, int *bad)
+{
+	int i = 1, k = 1, n;
+
+	spec[0] = '%';
+	spec[1] = '\0';
+	for (; fmt[i] && _strchr("-+ #0", fmt[i]); i++)
+		if (!_strchr(spec, fmt[i]))
+			spec[k++] = fmt[i], spec[k] = '\0';
+	n = printf_width(info, fmt + i, spec, &k, args, bad);
+	if (n >= 0 && fmt[i + n] == '.')
+	{
+		i += n;
+		spec[k++] = fmt[i++];
+		n = printf_width(info, fmt + i, spec, &k, args, bad);
+	}
+	i += n < 0 ? 0 : n;
+	spec[k] = fmt[i];
+	spec[k + 1] = '\0';
+	if (n < 0 || !fmt[i] || !_strchr("diouxXcsbfFeEgGaA", fmt[i]))
+		return (0);
+	return (i + 1);
+}
+
+/**
+ * printf_number - prints a numeric conversion of the printf builtin
+ * @info: the parameter struct, for error messages
+ * @spec: the conversion, checked by printf_spec()
+ * @arg: the argument for it, NULL once the arguments ran out; 'c or "c
+ *       stands for the code of c
+ *
+ * Return: 0 on success, 1 if arg is not a valid number or out of range
+ */
+int printf_number(info_t *info, char *spec, char *arg)
+{
+	char fmt[72], *end = "";
+	int k = _strlen(spec), real = _strchr("fFeEgGaA", spec[k - 1]) != NULL;
+	long n = 0;
+	double d = 0;
+
+	errno = 0;
+	if (arg && (*arg == '\'' || *arg == '"'))
+	{
+		n = (unsigned char)arg[1];
+		d = n;
+	}
+	else if (arg && real)
+		d = strtod(arg, &end);
+	else if (arg && _strchr("di", spec[k - 1]))
+		n = strtol(arg, &end, 0);
+	else if (arg)
+		n = (long)strtoul(arg, &end, 0);
+	_strncpy(fmt, spec, k);
+	fmt[k - 1] = 'l';
+	fmt[k] = spec[k - 1];
+	fmt[k + 1] = '\0';
+	if (real)
+		put_formatted(spec, d);
+	else
+		put_formatted(fmt, n);
+	return (printf_bad(info, arg, end));
+}
@@ -41,8 +41,6 @@ void ffree(char **pp)
  */
 void *_realloc(void *ptr, unsigned int old_size, unsigned int new_size)
 {
-	char *p;
-
 	if (!ptr)
 		return (malloc(new_size));
 	if (!new_size)
@@ -50,13 +48,6 @@ void *_realloc(void *ptr, unsigned int old_size, unsigned int new_size)
 	if (new_size == old_size)
 		return (ptr);
 
-	p = malloc(new_size);
-	if (!p)
-		return (NULL);
-
-	old_size = old_size < new_size ? old_size : new_size;
-	while (old_size--)
-		p[old_size] = ((char *)ptr)[old_size];
-	free(ptr);
-	return (p);
+	/* realloc() grows in place when it can and copies with memcpy() */
+	return (realloc(ptr, new_size));
 }
@@ -0,0 +1,170 @@
+#include "shell.h"
+
+/**
+ * parse_redir - recognizes a redirection word such as >file, 2>&1,
+ * >>, N<, <<EOF or <<<word, taking the target from the next word when it is detached
+ * @word: the word
+ * @next: the word after it, or NULL
+ * @r: the redirection to fill in, its target pointing into word or next
+ *
+ * Return: number of words used, 0 if not a redirection, -1 on error
+ */
+int parse_redir(char *word, char *next, redir_t *r)
+{
+	int i = 0;
+	char *op, *target;
+
+	while (word[i] >= '0' && word[i] <= '9')
+		i++;
+	op = word + i;
+	if (*op != '<' && *op != '>')
+		return (0);
+	r->fd = i ? (int)strtol(word, NULL, 10) : *op == '>';
+	if (op[0] == '<' && op[1] == '<' && (op[2] == '<' || op[2] == '-'))
+		r->flags = op[2] == '<' ? REDIR_HERESTR : REDIR_HERE_TAB, op += 3;
+	else if (op[0] == '<' && op[1] == '<')
+		r->flags = REDIR_HEREDOC, op += 2;
+	else if (op[1] == '&')
+		r->flags = REDIR_DUP, op += 2;
+	else if (op[0] == '>' && op[1] == '>')
+		r->flags = O_WRONLY | O_CREAT | O_APPEND, op += 2;
+	else if (op[0] == '<' && op[1] == '>')
+		r->flags = O_RDWR | O_CREAT, op += 2;
+	else if (op[0] == '>')
+		r->flags = O_WRONLY | O_CREAT | O_TRUNC, op += 1 + (op[1] == '|');
+	else
+		r->flags = O_RDONLY, op++;
+	target = *op ? op : next;
+	if (!target)
+		return (-1);
+	if (r->flags == REDIR_DUP && !_strcmp(target, "-"))
+		r->flags = REDIR_CLOSE;
+	else if (r->flags == REDIR_DUP)
+		for (i = 0; target[i]; i++)
+			if (target[i] < '0' || target[i] > '9')
+				return (-1);
+	r->target = target;
+	r->src = -1;
+	r->saved = -1;
+	r->next = NULL;
+	return (*op ? 1 : 2);
+}
+
+/**
+ * copy_redirs - copies the redirections of a syntax tree node for one run,
+ * expanding their targets; here-documents get the text to feed in, as
+ * REDIR_HERE_RAW
+ * @info: the parameter struct
+ * @r: the redirections as parsed
+ * @copy: receives the copy, in the arena, nothing opened yet
+ *
+ * Return: 0 on success, 1 on malloc failure
+ */
+int copy_redirs(info_t *info, redir_t *r, redir_t **copy)
+{
+	redir_t **tail = copy;
+
+	*copy = NULL;
+	for (; r; r = r->next)
+	{
+		*tail = arena_alloc(&(info->arena), sizeof(redir_t));
+		if (!*tail)
+			return (1);
+		**tail = *r;
+		if (r->flags <= REDIR_HEREDOC)
+			(*tail)->flags = REDIR_HERE_RAW;
+		(*tail)->target = r->flags <= REDIR_HEREDOC ? here_text(info, r) :
+			expand_word(info, r->target, 0);
+		(*tail)->src = -1;
+		(*tail)->saved = -1;
+		(*tail)->next = NULL;
+		if (!(*tail)->target)
+			return (1);
+		tail = &((*tail)->next);
+	}
+	return (0);
+}
+
+/**
+ * open_redirs - opens the files named by the redirections, close-on-exec,
+ * so failures are reported by the shell before anything is started; each
+ * is moved to FD_SHELL_MIN or above, so it is never the descriptor it is
+ * to be dup2()'ed onto, nor one a later redirection replaces
+ * @info: the parameter struct
+ *
+ * Return: 0 on success, 1 if a file could not be opened
+ */
+int open_redirs(info_t *info)
+{
+	redir_t *r;
+	int fd;
+
+	for (r = info->redirs; r; r = r->next)
+	{
+		if (r->flags == REDIR_DUP)
+			r->src = (int)strtol(r->target, NULL, 10);
+		if (r->src != -1 || (r->flags < 0 && r->flags != REDIR_HERE_RAW))
+			continue;
+		if (r->flags == REDIR_HERE_RAW)
+			r->src = here_fd(r->target);
+		else
+			r->src = open(r->target, r->flags | O_CLOEXEC, 0644);
+		if (r->src != -1 && (r->src < FD_SHELL_MIN || r->src == r->fd))
+		{
+			fd = fcntl(r->src, F_DUPFD_CLOEXEC, FD_SHELL_MIN);
+			close(r->src);
+			r->src = fd;
+		}
+		if (r->src == -1)
+		{
+			_eputs(info->fname);
+			_eputs(": ");
+			print_d(info->line_count, STDERR_FILENO);
+			_eputs(r->flags == O_RDONLY ? ": cannot open " : ": cannot create ");
+			_eputs(r->flags == REDIR_HERE_RAW ? "here-document" : r->target);
+			_eputs(": ");
+			_eputs(strerror(errno));
+			_eputchar('\n');
+			return (info->status = 1);
+		}
+	}
+	return (0);
+}
+
+/**
+ * free_redirs - closes the files opened for the current command and
+ * drops its redirection list, which is in the arena
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void free_redirs(info_t *info)
+{
+	redir_t *r;
+
+	for (r = info->redirs; r; r = r->next)
+		if ((r->flags >= 0 || r->flags == REDIR_HERE_RAW) && r->src != -1)
+			close(r->src);
+	info->redirs = NULL;
+}
+
+/**
+ * redir_actions - adds the redirections to a posix_spawn() file action
+ * list, so they are performed in the child between fork and exec
+ * @info: the parameter struct
+ * @actions: the file actions
+ *
+ * Return: void
+ */
+void redir_actions(info_t *info, posix_spawn_file_actions_t *actions)
+{
+	redir_t *r;
+
+	for (r = info->redirs; r; r = r->next)
+	{
+		if (r->flags == REDIR_CLOSE)
+			posix_spawn_file_actions_addclose(actions, r->fd);
+		else
+			posix_spawn_file_actions_adddup2(actions, r->src, r->fd);
+	}
+}
@@ -0,0 +1,120 @@
+#include "shell.h"
+
+/**
+ * claim_fd - makes sure a descriptor the user redirects is not one the
+ * shell itself is using, moving the script descriptor out of the way
+ * @info: the parameter struct
+ * @fd: the descriptor about to be replaced
+ *
+ * Return: void
+ */
+void claim_fd(info_t *info, int fd)
+{
+	int moved;
+
+	if (fd != info->readfd || fd <= STDERR_FILENO)
+		return;
+	moved = fcntl(fd, F_DUPFD_CLOEXEC, FD_SHELL_MIN);
+	if (moved == -1)
+		return;
+	close(fd);
+	info->readfd = moved;
+}
+
+/**
+ * apply_redirs - performs the redirections in the shell process itself
+ * @info: the parameter struct, files already opened by open_redirs()
+ * @save: if on, keep a copy of each replaced descriptor for
+ *        restore_redirs(); off makes the redirections permanent
+ *
+ * Return: void
+ */
+void apply_redirs(info_t *info, int save)
+{
+	redir_t *r;
+
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	for (r = info->redirs; r; r = r->next)
+	{
+		claim_fd(info, r->fd);
+		r->saved = save ? fcntl(r->fd, F_DUPFD_CLOEXEC, FD_SHELL_MIN) : -1;
+		if (r->flags == REDIR_CLOSE)
+			close(r->fd);
+		else if (r->src != r->fd)
+			dup2(r->src, r->fd);
+	}
+}
+
+/**
+ * restore_redirs - undoes apply_redirs(), last redirection first
+ * @r: the first redirection of the list to undo
+ *
+ * Return: void
+ */
+void restore_redirs(redir_t *r)
+{
+	if (!r)
+		return;
+	restore_redirs(r->next);
+	if (r->saved != -1)
+	{
+		dup2(r->saved, r->fd);
+		close(r->saved);
+		r->saved = -1;
+	}
+	else
+		close(r->fd);
+}
+
+/**
+ * run_builtin - runs a builtin with the command's redirections applied
+ * to the shell for the duration of the call
+ * @info: the parameter struct
+ * @builtin: the builtin to run
+ *
+ * Return: the builtin's return value, 1 if a redirection failed
+ */
+int run_builtin(info_t *info, builtin_table *builtin)
+{
+	int ret;
+
+	if (!info->redirs || builtin->func == _myexec)
+		return (builtin->func(info));
+	if (open_redirs(info))
+		return (1);
+	apply_redirs(info, 1);
+	ret = builtin->func(info);
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	restore_redirs(info->redirs);
+	return (ret);
+}
+
+/**
+ * _myexec - with only redirections, applies them to the shell for good,
+ * e.g. `exec 3>>log`; otherwise replaces the shell with the command
+ * @info: Structure containing potential arguments. Used to maintain
+ *         a consistent function prototype.
+ * Return: 0 on success, 1 if a redirection failed; does not return
+ *         when a command is given
+ */
+int _myexec(info_t *info)
+{
+	char *path;
+
+	if (open_redirs(info))
+		return (1);
+	apply_redirs(info, 0);
+	if (info->argc < 2)
+		return (0);
+	path = findPath(info, _getenv(info, "PATH="), info->argv[1]);
+	if (!path)
+		path = info->argv[1];
+	execve(path, info->argv + 1, get_environ(info));
+	info->status = exec_status(errno);
+	print_error(info, info->status == 126 ? "Permission denied\n" :
+			"not found\n");
+	_eputchar(BUF_FLUSH);
+	exit(info->status);
+}
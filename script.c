@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+ * script_read - loads a script that cannot be mapped with large read()s
+ * @info: the parameter struct, info->readfd is the script
+ * @size: the size of the script file
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int script_read(info_t *info, size_t size)
+{
+	char *data;
+	size_t n = 0;
+	ssize_t r;
+
+	data = malloc(size + 1);
+	if (!data)
+		return (1);
+	posix_fadvise(info->readfd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	while (n < size)
+	{
+		r = read(info->readfd, data + n, size - n);
+		if (r == -1 && errno == EINTR)
+			continue;
+		if (r <= 0)
+			break;
+		n += r;
+	}
+	data[n] = '\0';
+	info->script.data = data;
+	info->script.size = n;
+	info->script.pos = 0;
+	info->script.mapped = 0;
+	return (0);
+}
+
+/**
+ * script_open - maps a regular script file read-only, so its lines are
+ * taken from the page cache with no copy of the file; other files keep
+ * the streaming _getline() path
+ * @info: the parameter struct, info->readfd is the script
+ *
+ * Return: 0 if the script is loaded, 1 if it should be streamed
+ */
+int script_open(info_t *info)
+{
+	struct stat st;
+	char *data;
+
+	if (fstat(info->readfd, &st) == -1 || !S_ISREG(st.st_mode) ||
+			st.st_size <= 0)
+		return (1);
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, info->readfd, 0);
+	if (data == MAP_FAILED)
+		return (script_read(info, st.st_size));
+	madvise(data, st.st_size, MADV_SEQUENTIAL);
+	info->script.data = data;
+	info->script.size = st.st_size;
+	info->script.pos = 0;
+	info->script.mapped = 1;
+	info->script.mtime = st.st_mtime;
+	return (0);
+}
+
+/**
+ * script_changed - checks that a mapped script still has the size and
+ * modification time it was mapped with; if not, e.g. it was truncated,
+ * where reading the mapping past the new end would raise SIGBUS, the rest
+ * of the file from the current line on is read into memory instead
+ * @info: the parameter struct
+ *
+ * Return: 0 if the script can still be read, 1 on failure
+ */
+int script_changed(info_t *info)
+{
+	script_t *s = &(info->script);
+	struct stat st;
+	size_t pos = s->pos;
+
+	if (!s->mapped)
+		return (0);
+	if (fstat(info->readfd, &st) == -1)
+		st.st_size = 0;
+	else if (st.st_mtime == s->mtime && (size_t)st.st_size == s->size)
+		return (0);
+	munmap(s->data, s->size);
+	s->data = NULL;
+	s->mapped = 0;
+	if ((size_t)st.st_size < pos ||
+			lseek(info->readfd, pos, SEEK_SET) == -1)
+		st.st_size = pos;
+	return (script_read(info, st.st_size - pos));
+}
+
+/**
+ * script_line - hands out the next line of a loaded script, newline
+ * included: a slice of the script read into memory, or a copy in
+ * info->script.line of a line of a mapping, which is never written to
+ * @info: the parameter struct
+ * @line: receives the start of the line, followed by '\n' or '\0'
+ *
+ * Return: the length of the line, -1 at the end of the script
+ */
+ssize_t script_line(info_t *info, char **line)
+{
+	script_t *s = &(info->script);
+	char *start, *nl;
+	size_t len;
+
+	if (script_changed(info) || s->pos >= s->size)
+		return (-1);
+	start = s->data + s->pos;
+	nl = memchr(start, '\n', s->size - s->pos);
+	len = nl ? (size_t)(nl - start) + 1 : s->size - s->pos;
+	s->pos += len;
+	*line = start;
+	if (!s->mapped)
+		return (len);
+	if (len >= s->cap)
+	{
+		free(s->line);
+		s->cap = len * 2 + 1;
+		s->line = malloc(s->cap);
+		if (!s->line)
+			return (s->cap = 0, -1);
+	}
+	memcpy(s->line, start, len);
+	s->line[len] = '\0';
+	*line = s->line;
+	return (len);
+}
+
+/**
+ * script_close - releases a loaded script
+ * @info: the parameter struct
+ *
+ * Return: void
+ */
+void script_close(info_t *info)
+{
+	if (info->script.mapped)
+		munmap(info->script.data, info->script.size);
+	else
+		free(info->script.data);
+	bfree((void **)&(info->script.line));
+	info->script.data = NULL;
+	info->script.size = info->script.pos = info->script.cap = 0;
+	info->script.mapped = 0;
+}
@@ -1,6 +1,8 @@
 #ifndef _SHELL_H_
 #define _SHELL_H_
 
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -11,17 +13,27 @@
 #include <limits.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <spawn.h>
+#include <sys/mman.h>
+#include <fnmatch.h>
+#include <dirent.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/file.h>
+#include <sys/uio.h>
 
 /* for read/write buffers */
-#define READ_BUF_SIZE 1024
+#define READ_BUF_SIZE 65536
 #define WRITE_BUF_SIZE 1024
 #define BUF_FLUSH -1
 
-/* for command chaining */
-#define CMD_NORMAL 0
-#define CMD_OR 1
-#define CMD_AND 2
-#define CMD_CHAIN 3
+/* for the per-command arena, see arena.c */
+#define ARENA_CHUNK 65536
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+#define CHUNK_DATA(c) ((char *)(c) + ARENA_ROUND(sizeof(chunk_t)))
 
 /* for convert_number() */
 #define CONVERT_LOWERCASE 1
@@ -31,8 +43,100 @@
 #define USE_GETLINE 0
 #define USE_STRTOK 0
 
+/* 1 to launch commands with posix_spawn(), 0 for plain fork()/execve() */
+#ifndef USE_SPAWN
+#define USE_SPAWN 1
+#endif
+
+/* for the job table */
+#define JOB_RUNNING 0
+#define JOB_STOPPED 1
+#define JOB_DONE 2
+
+/* for the resolved command table */
+#define CMD_HASH_SIZE 64
+
+/* for the line editor, see edit.c */
+#define CTRL_KEY(c) ((c) & 037)
+#define KEY_DELETE 256
+#define EDIT_LIST_MAX 100
+#define EDIT_SEARCH_MAX 256
+
+/* for redir_t flags that are not open(2) flags, see redir.c */
+#define REDIR_DUP -1
+#define REDIR_CLOSE -2
+/* here-documents are REDIR_HEREDOC and below, see heredoc.c */
+#define REDIR_HEREDOC -3
+#define REDIR_HERE_TAB -4
+#define REDIR_HERE_RAW -5
+#define REDIR_HERESTR -6
+/* the shell's own descriptors live at or above this number */
+#define FD_SHELL_MIN 10
+
+/* for lexer_t token types, see lexer.c */
+#define TOK_WORD 0
+#define TOK_NEWLINE 1
+#define TOK_EOF 2
+#define TOK_SEMI 3
+#define TOK_AMP 4
+#define TOK_PIPE 5
+#define TOK_AND_IF 6
+#define TOK_OR_IF 7
+#define TOK_REDIR 8
+#define TOK_LPAREN 9
+#define TOK_RPAREN 10
+#define TOK_DSEMI 11
+
+/* for char_class[], see chartab.c */
+#define CC_BLANK 0x01
+#define CC_META 0x02
+#define CC_QUOTE 0x04
+#define CC_EXPAND 0x08
+#define CC_HASH 0x10
+#define CC_DIGIT 0x20
+#define CC_NAME 0x40
+#define CC_SPECIAL (CC_BLANK | CC_META | CC_QUOTE | CC_EXPAND | CC_HASH)
+
+/* for node_t types, see parse.c */
+#define NODE_CMD 0
+#define NODE_PIPE 1
+#define NODE_AND 2
+#define NODE_OR 3
+#define NODE_SEQ 4
+#define NODE_BG 5
+#define NODE_IF 6
+#define NODE_WHILE 7
+#define NODE_UNTIL 8
+#define NODE_FOR 9
+#define NODE_CASE 10
+#define NODE_ITEM 11
+
+/* for info->skip, set by break and continue; SKIP_INTR and up stop all */
+#define SKIP_BREAK 1
+#define SKIP_CONT 2
+#define SKIP_INTR 3
+#define SKIP_ERROR 4
+
+/* sigint_seen while a line is read, see getLine.c */
+#define SIGINT_READING 2
+
+/* for the environment table, see envmap.c */
+#define ENV_EMPTY -1
+#define ENV_DELETED -2
+#define ENV_MIN_SLOTS 64
+
 #define HIST_FILE ".simple_shell_history"
 #define HIST_MAX 4096
+#define HIST_SLAB 65536
+#define HIST_SYNC_SECS 2
+#define HIST_COMPACT 524288
+#define HIST_INDEX_SLOTS 4096
+#define TRIGRAM(s) (1u << 24 | (s)[0] << 16 | (s)[1] << 8 | (s)[2])
+
+/* for HISTCONTROL, see hist1.c */
+#define HIST_IGNOREDUPS 1
+#define HIST_IGNORESPACE 2
+#define HIST_ERASEDUPS 4
 
 extern char **environ;
 
@@ -49,6 +153,348 @@ typedef struct liststr
 	struct liststr *next;
 } list_t;
 
+/**
+ * struct numcache - the integer value of a variable
+ * @value: the value
+ * @valid: on if value is that of the variable's text as it is now
+ */
+typedef struct numcache
+{
+	long value;
+	int valid;
+} numcache_t;
+
+/**
+ * struct envmap - the environment: an envp array plus an open-addressing
+ * table of indices into it, keyed by variable name
+ * @envp: NULL-terminated "NAME=value" array, passed to execve() as is
+ * @count: the number of variables in envp
+ * @cap: the allocated length of envp
+ * @slots: indices into envp, or ENV_EMPTY / ENV_DELETED
+ * @nslots: the length of slots, a power of two
+ * @used: the number of slots that are not ENV_EMPTY
+ * @nums: the integer value of each envp entry, cached by arithmetic
+ *        expansion, see envnum.c
+ * @numcap: the allocated length of nums
+ */
+typedef struct envmap
+{
+	char **envp;
+	size_t count;
+	size_t cap;
+	int *slots;
+	size_t nslots;
+	size_t used;
+	numcache_t *nums;
+	size_t numcap;
+} envmap_t;
+
+/**
+ * struct cmdhash - resolved command table entry
+ * @name: the command name as typed
+ * @path: the full path found in PATH
+ * @hits: the number of times this entry was used
+ * @next: points to the next entry in the bucket
+ */
+typedef struct cmdhash
+{
+	char *name;
+	char *path;
+	int hits;
+	struct cmdhash *next;
+} cmdhash_t;
+
+/**
+ * struct alias - an alias, in a table of CMD_HASH_SIZE buckets, see alias.c
+ * @name: its name
+ * @value: its value as defined, for `alias` to print
+ * @text: a copy of the value, split in place into words
+ * @words: the words of the value as written, NULL-terminated, spliced
+ *         into the command in place of the name, see alias_expand()
+ * @nwords: the number of words
+ * @active: on while the expansion of a command goes through the alias
+ * @outer: the alias whose value started with this one, while active
+ * @next: points to the next alias in the bucket
+ */
+typedef struct alias
+{
+	char *name;
+	char *value;
+	char *text;
+	char **words;
+	int nwords;
+	int active;
+	struct alias *outer;
+	struct alias *next;
+} alias_t;
+
+/**
+ * struct reader - the input buffer of _getline(), lines handed out in place
+ * @buf: the buffer
+ * @start: offset of the first byte not handed out yet
+ * @end: offset past the last byte read
+ * @size: the allocated size of buf, doubled when a line does not fit
+ */
+typedef struct reader
+{
+	char *buf;
+	size_t start;
+	size_t end;
+	size_t size;
+} reader_t;
+
+/**
+ * struct chunk - one block of an arena, its bytes following the header
+ * at CHUNK_DATA()
+ * @next: the next block, kept for reuse once released
+ * @size: the number of bytes after the header
+ */
+typedef struct chunk
+{
+	struct chunk *next;
+	size_t size;
+} chunk_t;
+
+/**
+ * struct arena - bump allocator for the memory of a command line: its
+ * syntax tree, words and expansions, released all at once
+ * @head: the first block, NULL until something is allocated
+ * @cur: the block allocations come from, NULL for the start of head
+ * @used: the number of bytes used in cur
+ */
+typedef struct arena
+{
+	chunk_t *head;
+	chunk_t *cur;
+	size_t used;
+} arena_t;
+
+/**
+ * struct arena_mark - a position in an arena to release back to
+ * @cur: the block in use when the mark was taken
+ * @used: the number of bytes used in it then
+ */
+typedef struct arena_mark
+{
+	chunk_t *cur;
+	size_t used;
+} arena_mark_t;
+
+/**
+ * struct script - a script file loaded whole by script_open()
+ * @data: the contents, a read-only mapping of the file, or read into
+ *        memory and followed by a '\0'
+ * @size: the length of the contents
+ * @pos: offset of the next line to hand out
+ * @mapped: on if data is an mmap()ed view of the file
+ * @mtime: the modification time of the file when it was mapped
+ * @line: the last line handed out of a mapped script, NUL-terminated
+ * @cap: the size of the line buffer
+ */
+typedef struct script
+{
+	char *data;
+	size_t size;
+	size_t pos;
+	int mapped;
+	time_t mtime;
+	char *line;
+	size_t cap;
+} script_t;
+
+/**
+ * struct redir - one redirection of the current command
+ * @fd: the descriptor being redirected
+ * @flags: open(2) flags for a file target, or one of REDIR_*: for a
+ *         here-document, REDIR_HEREDOC if its body is expanded,
+ *         REDIR_HERE_RAW if not, REDIR_HERE_TAB for <<- until the body
+ *         is read, and REDIR_HERESTR for <<<word
+ * @target: the file name, the source descriptor for REDIR_DUP, the body
+ *          of a here-document or the word of a here-string
+ * @src: the opened file or source descriptor, -1 until open_redirs()
+ * @saved: copy of the replaced descriptor while a builtin runs, or -1
+ * @next: points to the next redirection
+ */
+typedef struct redir
+{
+	int fd;
+	int flags;
+	char *target;
+	int src;
+	int saved;
+	struct redir *next;
+} redir_t;
+
+/**
+ * struct job - a background pipeline in the job table
+ * @id: the job number used as %n
+ * @pgid: the process group of the job
+ * @pids: pid of each stage, negated once reaped, 0 if it never started
+ * @npids: the number of stages
+ * @running: the number of stages not yet reaped
+ * @state: JOB_RUNNING, JOB_STOPPED or JOB_DONE
+ * @status: the exit status of the last stage
+ * @cmd: the command text, for `jobs`
+ * @next: points to the next job
+ */
+typedef struct job
+{
+	int id;
+	pid_t pgid;
+	pid_t *pids;
+	int npids;
+	int running;
+	int state;
+	int status;
+	char *cmd;
+	struct job *next;
+} job_t;
+
+/**
+ * struct histent - a history entry
+ * @off: where its text starts in the slab
+ * @len: the length of the text
+ * @hash: a hash of the text, to find duplicates without comparing texts
+ */
+typedef struct histent
+{
+	size_t off;
+	size_t len;
+	size_t hash;
+} histent_t;
+
+/**
+ * struct trigram - the history entries three bytes occur in together
+ * @key: the three bytes, with 1 above them; 0 for a free slot
+ * @count: the number of entries
+ * @size: the room in ids
+ * @ids: the entries, by their number less the index's start, ascending
+ */
+typedef struct trigram
+{
+	unsigned int key;
+	unsigned int count;
+	unsigned int size;
+	unsigned int *ids;
+} trigram_t;
+
+/**
+ * struct histindex - a trigram index of the history, built at the first
+ * search and brought up to date at the next ones, see histfind.c
+ * @slots: the trigrams, open addressed, a power of two of them
+ * @size: the number of slots
+ * @used: the number of trigrams
+ * @start: the number of the first entry indexed
+ * @next: the number of the next entry to index
+ */
+typedef struct histindex
+{
+	trigram_t *slots;
+	size_t size;
+	size_t used;
+	size_t start;
+	size_t next;
+} histindex_t;
+
+/**
+ * struct history - the history: a ring of at most max entries, the
+ * oldest dropped to make room for a new one, numbered from the number of
+ * the oldest so nothing is renumbered; their texts are kept in order in
+ * a slab that is used as a ring too, see hist.c
+ * @ents: the ring, which grows up to max entries
+ * @cap: the number of entries ents has room for
+ * @max: the number of entries kept, HISTSIZE or HIST_MAX
+ * @first: the position in ents of the oldest entry
+ * @count: the number of entries
+ * @base: the number of the oldest entry
+ * @slab: the texts, each NUL-terminated
+ * @size: the size of slab
+ * @head: where the next text goes in slab
+ * @fd: the history file, open for appending, or -1 until it is needed
+ * @unsaved: the number of newest entries not appended to the file yet
+ * @synced: when the file was last fsync()'ed
+ * @limit: the size of the file past which it is compacted, see histlog.c
+ * @map: the history file as it was when the shell started, mapped
+ *       read-only; its lines come before the entries, see hist2.c
+ * @maplen: the length of map
+ * @lines: the offsets in map of the end of its last complete line, then
+ *         of the starts of its lines from the newest back, found only as
+ *         far back as the history has been looked at
+ * @nlines: the number of lines found
+ * @linecap: the number of offsets lines has room for
+ * @index: the index for searches
+ */
+typedef struct history
+{
+	histent_t *ents;
+	size_t cap;
+	size_t max;
+	size_t first;
+	size_t count;
+	size_t base;
+	char *slab;
+	size_t size;
+	size_t head;
+	int fd;
+	size_t unsaved;
+	time_t synced;
+	off_t limit;
+	char *map;
+	size_t maplen;
+	size_t *lines;
+	size_t nlines;
+	size_t linecap;
+	histindex_t index;
+} history_t;
+
+/**
+ * struct cmdindex - the names of the executables on PATH, sorted, for
+ * command completion, see complete.c
+ * @path: the value of PATH the index was built from
+ * @names: the names, packed one after the other
+ * @len: the number of bytes used in names
+ * @size: the size of names
+ * @sorted: pointers to the names, in strcmp() order, without duplicates
+ * @count: the number of entries in sorted
+ */
+typedef struct cmdindex
+{
+	char *path;
+	char *names;
+	size_t len;
+	size_t size;
+	char **sorted;
+	size_t count;
+} cmdindex_t;
+
+/**
+ * struct editor - the line editor used to read interactive input
+ * @line: the line being edited
+ * @len: its length
+ * @size: the allocated size of line
+ * @pos: the offset of the cursor in line
+ * @shown: the screen column of the cursor past the prompt
+ * @prompt: the prompt printed before the line, to print it again
+ * @hist: how many entries back in history the line was recalled from,
+ *        0 for the line being typed
+ * @draft: the line being typed, kept while history is browsed
+ * @tty: the terminal settings to restore once the line is read
+ * @index: the executables on PATH, built at the first completion
+ */
+typedef struct editor
+{
+	char *line;
+	size_t len;
+	size_t size;
+	size_t pos;
+	size_t shown;
+	char *prompt;
+	int hist;
+	char *draft;
+	struct termios tty;
+	cmdindex_t index;
+} editor_t;
+
 /**
  * struct passinfo - contains pseudo-arguments to pass into a function,
  * allowing a uniform prototype for the function pointer struct
@@ -58,17 +504,37 @@ typedef struct liststr
  * @argc: the argument count
  * @line_count: the error count
  * @err_num: the error code for exit()
- * @linecount_flag: if on, count this line of input
+ * @input_line: the number of input lines read so far
  * @fname: the program filename
- * @env: linked list local copy of environ
- * @history: the history node
- * @alias: the alias node
- * @env_changed: on if environ was changed
+ * @env: local copy of environ, see envmap.c
+ * @history: the commands entered, see hist.c
+ * @alias: the aliases, see alias.c
  * @status: the return status of the last exec'd command
- * @cmd_buf: address of pointer to cmd_buf, on if chaining
- * @cmd_buf_type: CMD_type ||, &&, ;
+ * @input: the input buffer of _getline()
  * @readfd: the fd from which to read line input
- * @histcount: the history line number count
+ * @cmd_hash: table of resolved command paths, see hash.c
+ * @jobs: the background job table
+ * @background: on if the current command ended with '&'
+ * @last_bg: pid of the most recent background command, for $!
+ * @redirs: the redirections of the current command
+ * @script: the script being run, if it could be loaded whole
+ * @loop_depth: the number of loops being run
+ * @skip: SKIP_BREAK or SKIP_CONT while break or continue unwinds loops,
+ *        SKIP_INTR while Ctrl-C unwinds everything back to the prompt,
+ *        SKIP_ERROR after an error that ends a script, see shell_error()
+ * @skip_count: the number of loops left to unwind
+ * @arena: memory for the current command line, see arena.c
+ * @saved_vars: the variables a command's assignments replaced, restored
+ *              once it is done, see argv.c
+ * @nsaved: the number of entries in saved_vars
+ * @pid: the shell's pid as text, for $$
+ * @source: the rest of a command substitution being parsed, read in
+ *          place of the input when not NULL, see subst.c
+ * @subst_status: the status of the last command substitution of the
+ *                current command, the status of a command without one
+ * @edit: the interactive line editor, see edit.c
+ * @monitor: on when jobs get process groups of their own and the
+ *           terminal, i.e. job control, see jobs.c
  */
 typedef struct passinfo
 {
@@ -78,24 +544,180 @@ typedef struct passinfo
 	int argc;
 	unsigned int line_count;
 	int err_num;
-	int linecount_flag;
+	unsigned int input_line;
 	char *fname;
-	list_t *env;
-	list_t *history;
-	list_t *alias;
-	char **environ;
-	int env_changed;
+	envmap_t env;
+	history_t history;
+	alias_t **alias;
 	int status;
 
-	char **cmd_buf; /* pointer to cmd ; chain buffer, for memory management */
-	int cmd_buf_type; /* CMD_type ||, &&, ; */
+	reader_t input;
 	int readfd;
-	int histcount;
+	cmdhash_t **cmd_hash;
+	job_t *jobs;
+	int background;
+	pid_t last_bg;
+	redir_t *redirs;
+	script_t script;
+	int loop_depth;
+	int skip;
+	int skip_count;
+	arena_t arena;
+	char **saved_vars;
+	int nsaved;
+	char pid[16];
+	char *source;
+	int subst_status;
+	editor_t edit;
+	int monitor;
 } info_t;
 
 #define INFO_INIT \
-{NULL, NULL, NULL, 0, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, 0, 0, NULL, \
-		0, 0, 0}
+{NULL, NULL, NULL, 0, 0, 0, 0, NULL, {NULL, 0, 0, NULL, 0, 0, NULL, 0}, \
+		{NULL, 0, HIST_MAX, 0, 0, 0, NULL, 0, 0, -1, 0, 0, 0, NULL, 0, NULL, \
+		0, 0, {NULL, 0, 0, 0, 0}}, NULL, 0, \
+		{NULL, 0, 0, 0}, 0, NULL, NULL, 0, 0, NULL, \
+		{NULL, 0, 0, 0, 0, NULL, 0}, 0, 0, 0, \
+		{NULL, NULL, 0}, NULL, 0, "", NULL, 0, \
+		{NULL, 0, 0, 0, 0, NULL, 0, NULL, {0}, {NULL, NULL, 0, 0, NULL, 0}}, \
+		0}
+
+#define EXP_SPLIT	1
+#define EXP_PATTERN	2
+#define EXP_GLOB	4
+#define EXP_WORD	8
+
+/**
+ * struct expand - expands words into fields in one pass, see expand.c
+ * @info: the parameter struct
+ * @buf: the fields, each NUL-terminated, at the top of the arena
+ * @len: the number of bytes used in buf
+ * @size: the size of buf
+ * @start: where the current field starts in buf
+ * @nfields: the number of fields ended so far
+ * @keep: on if the current field had something quoted, so it is kept
+ *        even if empty
+ * @flags: EXP_SPLIT to split unquoted expansions on IFS, EXP_PATTERN
+ *         to escape quoted pattern characters for fnmatch(), EXP_GLOB
+ *         for that and pathname expansion of the fields, see glob.c;
+ *         EXP_WORD while the word of an unquoted ${name-word} or
+ *         ${name+word} is expanded, to split its unquoted text as well
+ */
+typedef struct expand
+{
+	info_t *info;
+	char *buf;
+	size_t len;
+	size_t size;
+	size_t start;
+	int nfields;
+	int keep;
+	int flags;
+} expand_t;
+
+/**
+ * struct dircache - the names in a directory, read once per expansion
+ * @path: the directory, "" for the current one
+ * @names: the names, in the order they were read
+ * @count: the number of names
+ * @next: the next directory read
+ */
+typedef struct dircache
+{
+	char *path;
+	char **names;
+	size_t count;
+	struct dircache *next;
+} dircache_t;
+
+/**
+ * struct pathglob - state of pathname expansion, see glob.c
+ * @info: the parameter struct
+ * @dirs: the directories read so far
+ * @fields: the fields expanded so far, in the arena
+ * @nfields: the number of them
+ * @size: the room in fields
+ * @path: the path being built
+ */
+typedef struct pathglob
+{
+	info_t *info;
+	dircache_t *dirs;
+	char **fields;
+	size_t nfields;
+	size_t size;
+	char path[PATH_MAX];
+} pathglob_t;
+
+/**
+ * struct arith - evaluates an arithmetic expression, see arith.c
+ * @info: the parameter struct
+ * @expr: the expression, for error messages
+ * @p: where evaluation is in it
+ * @skip: on inside an operand that is not evaluated, such as the right
+ *        of a && whose left is 0, so assignments in it do nothing
+ */
+typedef struct arith
+{
+	info_t *info;
+	char *expr;
+	char *p;
+	int skip;
+} arith_t;
+
+/**
+ * struct lexer - splits input into tokens, reading lines as needed
+ * @info: the parameter struct, the source of input lines
+ * @line: the current line, NULL once its newline token was returned
+ * @pos: offset of the next character in line
+ * @type: the type of the current token
+ * @text: the text of a TOK_WORD or TOK_REDIR token, malloc'ed
+ * @lines: the number of lines read for the current command
+ * @eof: on once the input is exhausted
+ * @error: on once a syntax error was reported
+ * @heredocs: the here-documents whose bodies start after this line
+ * @nheredocs: the number of them
+ */
+typedef struct lexer
+{
+	info_t *info;
+	char *line;
+	size_t pos;
+	int type;
+	char *text;
+	int lines;
+	int eof;
+	int error;
+	redir_t **heredocs;
+	int nheredocs;
+} lexer_t;
+
+/**
+ * struct node - a node of the syntax tree built by the parser
+ * @type: one of NODE_*
+ * @words: the words as written, NULL-terminated: the command for
+ *         NODE_CMD, the variable then the list for NODE_FOR, the subject
+ *         for NODE_CASE and the patterns for NODE_ITEM
+ * @nwords: the number of words
+ * @redirs: the redirections with their targets as written
+ * @line: the input line the command started on, for error messages
+ * @left: the first operand, the condition of an if or a loop, the body
+ *        of a for or a case item, or the first item of a case
+ * @right: the second operand, the body of a then or a loop, or the next
+ *         case item
+ * @next: the else part of an if, possibly another NODE_IF for elif
+ */
+typedef struct node
+{
+	int type;
+	char **words;
+	int nwords;
+	redir_t *redirs;
+	unsigned int line;
+	struct node *left;
+	struct node *right;
+	struct node *next;
+} node_t;
 
 /**
  * struct builtin - contains a builtin string and related function
@@ -108,8 +730,20 @@ typedef struct builtin
 	int (*func)(info_t *);
 } builtin_table;
 
+/**
+ * struct signame - a signal name known to kill
+ * @name: the name without the SIG prefix
+ * @num: the signal number
+ */
+typedef struct signame
+{
+	char *name;
+	int num;
+} signame_t;
+
 /* toem_shloop.c */
 int mainShellLoop(info_t *, char **);
+builtin_table *getBuiltin(char *);
 int findBuiltin(info_t *);
 void findCommand(info_t *);
 void forkCommand(info_t *);
@@ -117,116 +751,487 @@ void forkCommand(info_t *);
 /* toem_parser.c */
 int isCommand(info_t *, char *);
 char *duplicateChars(char *, int, int);
+char *searchPath(info_t *, char *, char *);
 char *findPath(info_t *, char *, char *);
 
+/* spawn.c */
+int exec_status(int);
+int decode_status(int);
+pid_t spawn_command(info_t *, posix_spawn_file_actions_t *,
+		posix_spawnattr_t *);
+pid_t fork_command(info_t *, int, int, pid_t);
+int wait_command(info_t *, pid_t);
+
+/* pipeline.c */
+pid_t spawn_stage(info_t *, int, int, pid_t);
+pid_t fork_stage(info_t *, node_t *, int, int, pid_t);
+pid_t start_stage(info_t *, node_t *, int, int, pid_t);
+int start_pipeline(info_t *, node_t **, pid_t *, int);
+int run_pipeline(info_t *, node_t *, int);
+
+/* lexer.c */
+int lex_fill(lexer_t *);
+char *lex_copy(char *, size_t);
+int lex_operator(lexer_t *);
+int lex_next(lexer_t *);
+char *tok_name(lexer_t *);
+
+/* chartab.c */
+extern const unsigned char char_class[256];
+char *cc_next(char *);
+
+/* lexer1.c */
+size_t lex_scan(char *, char *, int *);
+int lex_word(lexer_t *);
+
+/* parse.c */
+int parse_command(info_t *, node_t **);
+node_t *parse_list(lexer_t *, int);
+node_t *parse_and_or(lexer_t *);
+node_t *parse_pipeline(lexer_t *);
+node_t *parse_simple(lexer_t *);
+
+/* parse1.c */
+void parse_error(lexer_t *);
+void lex_linebreak(lexer_t *);
+int parse_redirect(lexer_t *, node_t *);
+int is_word(lexer_t *, char *);
+int parse_expect(lexer_t *, char *);
+
+/* parse2.c */
+int is_reserved(char *);
+int list_end(lexer_t *, int);
+node_t *parse_compound(lexer_t *);
+node_t *parse_if(lexer_t *);
+node_t *parse_do_group(lexer_t *);
+
+/* parse3.c */
+node_t *parse_loop(lexer_t *);
+node_t *parse_for(lexer_t *);
+node_t *parse_case_item(lexer_t *);
+node_t *parse_case(lexer_t *);
+
+/* ast.c */
+node_t *new_node(lexer_t *, int, node_t *, node_t *);
+int add_word(lexer_t *, node_t *, char *);
+char *join_words(char **, char *);
+
+/* arena.c */
+void *arena_alloc(arena_t *, size_t);
+void *arena_grow(arena_t *, void *, size_t, size_t);
+char *arena_copy(arena_t *, char *, size_t);
+
+/* arena1.c */
+arena_mark_t arena_mark(arena_t *);
+void arena_release(arena_t *, arena_mark_t);
+void arena_free(arena_t *);
+
+/* ast1.c */
+char *text_part(node_t *, char);
+char *node_text(node_t *);
+
+/* eval.c */
+int set_command(info_t *, node_t *);
+int eval_command(info_t *, node_t *);
+int eval_redirected(info_t *, node_t *);
+int eval_node(info_t *, node_t *);
+int eval_tree(info_t *, node_t *);
+
+/* eval1.c */
+int eval_if(info_t *, node_t *);
+int loop_skip(info_t *);
+int eval_loop(info_t *, node_t *);
+int eval_for(info_t *, node_t *);
+int eval_case(info_t *, node_t *);
+
+/* script.c */
+int script_read(info_t *, size_t);
+int script_open(info_t *);
+int script_changed(info_t *);
+ssize_t script_line(info_t *, char **);
+void script_close(info_t *);
+
+/* redir.c */
+int parse_redir(char *, char *, redir_t *);
+int copy_redirs(info_t *, redir_t *, redir_t **);
+int open_redirs(info_t *);
+void free_redirs(info_t *);
+void redir_actions(info_t *, posix_spawn_file_actions_t *);
+
+/* redir1.c */
+void claim_fd(info_t *, int);
+void apply_redirs(info_t *, int);
+void restore_redirs(redir_t *);
+int run_builtin(info_t *, builtin_table *);
+int _myexec(info_t *);
+
+/* jobs.c */
+void sigchldHandler(int);
+void init_jobs(info_t *);
+job_t *add_job(info_t *, pid_t *, int, int, char *);
+job_t *update_job(info_t *, pid_t, int);
+void collect_jobs(info_t *);
+void reap_jobs(info_t *);
+
+/* jobs1.c */
+job_t *find_job(info_t *, char *);
+void remove_job(info_t *, job_t *);
+int wait_job(info_t *, job_t *);
+void print_job(job_t *);
+void set_foreground(info_t *, pid_t);
+int kill_job(info_t *, job_t *, int);
+
+/* jobs2.c */
+int tty_stop(info_t *, pid_t);
+int wait_foreground(info_t *, pid_t *, int);
+job_t *stop_job(info_t *, pid_t *, int, char *);
+void job_signals(sigset_t *);
+void reset_signals(info_t *);
+
+/* alias.c */
+alias_t *alias_find(info_t *, char *);
+size_t alias_word(char *);
+int alias_split(alias_t *);
+int alias_set(info_t *, char *, char *);
+int alias_unset(info_t *, char *);
+
+/* alias1.c */
+char **alias_expand(info_t *, char **, int *);
+int alias_cmp(const void *, const void *);
+int alias_list(info_t *);
+void alias_free(info_t *);
+void alias_destroy(alias_t *);
+
+/* hash.c */
+unsigned int hash_key(char *);
+cmdhash_t *hash_find(info_t *, char *);
+cmdhash_t *hash_add(info_t *, char *, char *);
+void hash_forget(info_t *, char *);
+void hash_clear(info_t *);
+int print_hash(info_t *);
+
 /* loophsh.c */
 int loophsh(char **);
 
 /* toem_errors.c */
-void printError(char *);
-int printCharacter(char);
-int print_fd(char c, int fd);
-int print_string_fd(char *str, int fd);
+void _eputs(char *);
+int _eputchar(char);
+int _putfd(char c, int fd);
+int _putsfd(char *str, int fd);
+int print_syntax_error(info_t *, char *);
+int shell_error(info_t *);
 
 /* toem_string.c */
-int stringLength(char *);
-int stringCompare(char *, char *);
-char *startsWith(const char *, const char *);
-char *stringConcatenate(char *, char *);
+int _strlen(char *);
+int _strcmp(char *, char *);
+char *starts_with(const char *, const char *);
+char *_strcat(char *, char *);
 
 /* toem_string1.c */
-char *stringCopy(char *, char *);
-char *stringDuplicate(const char *);
-void printString(char *);
-int printCharacter(char);
+char *_strcpy(char *, char *);
+char *_strdup(const char *);
+void _puts(char *);
+int _putchar(char);
 
 /* toem_exits.c */
-char *stringNCopy(char *, char *, int);
-char *stringNCat(char *, char *, int);
-char *stringChar(char *, char);
+char *_strncpy(char *, char *, int);
+char *_strncat(char *, char *, int);
+char *_strchr(char *, char);
 
-/* toem_tokenizer.c */
-char **splitStringByDelimiters(char *, char *);
-char **splitStringByDelimiter(char *, char);
+/* argv.c */
+int set_argv(info_t *, char **, int);
+size_t is_assignment(char *);
+int save_var(info_t *, char *);
+int set_assigns(info_t *, char **, int, int);
+void restore_assigns(info_t *);
+
+/* expand.c */
+int exp_grow(expand_t *, size_t);
+int exp_put(expand_t *, char *, size_t, int);
+int exp_end(expand_t *);
+int exp_value(expand_t *, char *, size_t, int);
+int expand_fields(info_t *, char **, int, int, char ***);
+
+/* expand1.c */
+int exp_text(expand_t *, char *, char *, int);
+char *exp_param(expand_t *, char *, int);
+size_t param_name(char *);
+char *param_value(info_t *, char *, size_t, char *);
+char *skip_brace(char *);
+
+/* expand2.c */
+char *bad_subst(expand_t *);
+long exp_temp(expand_t *, char *, char *, int);
+char *exp_assign(expand_t *, char *, size_t, char *, char *);
+size_t trim_param(char *, char *, int, int, size_t *);
+char *exp_trim(expand_t *, char *, char *, char *, size_t *);
+char *exp_brace(expand_t *, char *, int);
+
+/* heredoc.c */
+int lex_pending(lexer_t *, redir_t *);
+char *here_delim(info_t *, char *, int *);
+int lex_heredocs(lexer_t *);
+
+/* heredoc1.c */
+char *expand_heredoc(info_t *, char *);
+char *here_text(info_t *, redir_t *);
+int here_fd(char *);
+
+/* subst.c */
+char *skip_subst(char *);
+void unbacktick(char *);
+int lex_source(lexer_t *);
+char *capture(int, size_t *);
+int subst_inline(info_t *, node_t *);
+
+/* subst1.c */
+int subst_assigns(node_t *);
+int subst_builtin(info_t *, node_t *);
+pid_t subst_start(info_t *, node_t *, int *);
+char *run_subst(info_t *, char *, size_t, int, size_t *);
+char *exp_subst(expand_t *, char *, int);
+
+/* glob.c */
+int glob_push(pathglob_t *, char *);
+int glob_cmp(const void *, const void *);
+int glob_dir(pathglob_t *, size_t, char *, size_t);
+int glob_walk(pathglob_t *, size_t, char *);
+int glob_fields(info_t *, char *, int, char ***);
+
+/* glob1.c */
+int dir_read(info_t *, dircache_t *);
+dircache_t *dir_cache(pathglob_t *, char *);
+int glob_meta(char *, size_t);
+size_t glob_prefix(char *, char **);
+int glob_name(char *, size_t, char *, char *);
+char *glob_unescape(char *);
 
 /* toem_realloc.c */
-char *memorySet(char *, char, unsigned int);
-void freeMemory(char **);
-void *reallocateMemory(void *, unsigned int, unsigned int);
+char *_memset(char *, char, unsigned int);
+void ffree(char **);
+void *_realloc(void *, unsigned int, unsigned int);
 
 /* toem_memory.c */
-int freeBlock(void **);
+int bfree(void **);
 
 /* toem_atoi.c */
 int interactive(info_t *);
-int isDelimiter(char, char *);
-int isAlpha(int);
-int stringToInteger(char *);
+int is_character_delimiter(char, const char *);
+int is_alphabet(char);
+int str_to_int(const char *);
 
 /* toem_errors1.c */
-int errorStringToInteger(char *);
-void printErrorString(char *);
-int printDecimal(int, int);
-char *convertNumber(long int, int, int);
-void removeComments(char *);
+int _erratoi(char *);
+void print_error(info_t *, char *);
+int print_d(int, int);
+char *convert_number(long int, int, int);
+void remove_comments(char *);
 
 /* toem_builtin.c */
-int myExit(info_t *);
-int myCd(info_t *);
-int myHelp(info_t *);
+int shell_exit(info_t *);
+int shell_change_dir(info_t *);
+int shell_help(info_t *);
 
 /* toem_builtin1.c */
-int myHistory(info_t *);
-int myAlias(info_t *);
+int display_history(info_t *);
+int handle_alias(info_t *);
+int show_alias(alias_t *);
+
+/* builtin2.c */
+int _myhash(info_t *);
+int _mycommand(info_t *);
+
+/* builtin3.c */
+int _myjobs(info_t *);
+int wait_next(info_t *);
+int _mywait(info_t *);
+int _myfg(info_t *);
+int _mybg(info_t *);
+
+/* builtin4.c */
+int _myecho(info_t *);
+int _mytrue(info_t *);
+int _mypwd(info_t *);
+int is_test_binary(char *);
+int _mytest(info_t *);
+
+/* builtin5.c */
+int _myprintf(info_t *);
+signame_t *get_signals(void);
+int sig_number(char *);
+int kill_target(info_t *, char *, int);
+int _mykill(info_t *);
+
+/* builtin6.c */
+int _mybreak(info_t *);
+int kill_list(info_t *);
+
+/* test.c */
+int test_unary(char *, char *);
+int test_binary(info_t *, char *, char *, char *);
+int test_primary(info_t *, int *, int);
+int test_and(info_t *, int *, int);
+int test_or(info_t *, int *, int);
+
+/* printf.c */
+int print_escape(char *, int *);
+void print_escapes(char *, int *);
+int put_formatted(const char *, ...);
+int printf_conv(info_t *, char *, char *, int *);
+int printf_format(info_t *, char *, char ***, int *);
+
+/* printf1.c */
+int printf_bad(info_t *, char *, char *);
+int printf_star(info_t *, char *, int *, char ***);
+int printf_width(info_t *, char *, char *, int *, char ***, int *);
+int printf_spec(info_t *, char *, char *, char ***, int *);
+int printf_number(info_t *, char *, char *);
+
+/* edit.c */
+void show_prompt(info_t *, char *);
+int edit_raw(info_t *, int);
+int edit_key(void);
+size_t edit_width(char *, size_t);
+void edit_refresh(info_t *);
+
+/* edit1.c */
+int edit_insert(info_t *, char *, size_t);
+void edit_delete(info_t *, size_t, size_t);
+void edit_move(info_t *, int);
+int edit_do(info_t *, int);
+ssize_t edit_line(info_t *, char **);
+
+/* edit2.c */
+int edit_recall(info_t *, int);
+void edit_list(info_t *, char **, size_t);
+int edit_matches(info_t *, char **, size_t, size_t, char *);
+int edit_files(info_t *, size_t);
+int edit_complete(info_t *);
+
+/* edit3.c */
+void edit_found(info_t *, char *, size_t, long, int);
+int edit_search(info_t *);
+
+/* complete.c */
+int index_dir(cmdindex_t *, char *);
+void index_sort(cmdindex_t *);
+int index_build(info_t *);
+size_t index_find(cmdindex_t *, char *, size_t, size_t *);
+void index_free(cmdindex_t *);
 
 /* toem_getline.c */
-ssize_t getInput(info_t *);
-int customGetline(info_t *, char **, size_t *);
+ssize_t get_input(info_t *);
+int _getline(info_t *, char **, size_t *);
 void sigintHandler(int);
+extern volatile sig_atomic_t sigint_seen;
+char *heredoc_body(info_t *, char *, int);
 
 /* toem_getinfo.c */
-void clearInfo(info_t *);
-void setInfo(info_t *, char **);
-void freeInfo(info_t *, int);
+void clear_info(info_t *);
+void free_info(info_t *, int);
 
 /* toem_environ.c */
-char *getEnvironmentVariable(info_t *, const char *);
-int myEnv(info_t *);
-int mySetenv(info_t *);
-int myUnsetenv(info_t *);
-int populateEnvironmentList(info_t *);
+char *_getenv(info_t *, const char *);
+int _myenv(info_t *);
+int _mysetenv(info_t *);
+int _myunsetenv(info_t *);
+int populate_env_list(info_t *);
 
 /* toem_getenv.c */
-char **getEnvironment(info_t *);
-int unsetEnvironmentVariable(info_t *, char *);
-int setEnvironmentVariable(info_t *, char *, char *);
+char **get_environ(info_t *);
+int _unsetenv(info_t *, char *);
+int _setenv(info_t *, char *, char *);
+char *env_value(info_t *, char *);
+void free_env(info_t *);
+
+/* envmap.c */
+size_t env_hash(const char *, size_t);
+long env_probe(envmap_t *, const char *, size_t, long *);
+int env_rehash(envmap_t *, size_t);
+int env_store(envmap_t *, char *);
+int env_remove(envmap_t *, char *);
+
+/* envnum.c */
+int env_cache(envmap_t *);
+void env_forget(envmap_t *, size_t);
+int arith_get(info_t *, char *, size_t, long *);
+int arith_set(info_t *, char *, size_t, long);
+
+/* arith.c */
+int arith_error(arith_t *, char *);
+int arith_primary(arith_t *, long *);
+int arith_unary(arith_t *, long *);
+int arith_binary(arith_t *, int, long *);
+int arith_expr(arith_t *, long *);
+
+/* arith1.c */
+void arith_space(arith_t *);
+const char *arith_op(arith_t *, int *);
+int arith_apply(arith_t *, const char *, long *, long);
+int arith_assign(arith_t *, char *, size_t, long *);
+char *exp_arith(expand_t *, char *, int);
+
+/* hist.c */
+histent_t *hist_at(history_t *, size_t);
+long hist_fits(history_t *, size_t);
+int hist_grow(history_t *, size_t);
+int hist_push(history_t *, char *, size_t);
+int hist_add(info_t *, char *, size_t);
+
+/* hist1.c */
+int hist_same(history_t *, histent_t *, char *, size_t, size_t);
+void hist_erase(history_t *, char *, size_t, size_t);
+int hist_control(info_t *);
+void hist_free(history_t *);
+
+/* hist2.c */
+int hist_lines(history_t *, size_t);
+size_t hist_count(history_t *);
+char *hist_entry(history_t *, size_t, size_t *);
+size_t hist_number(history_t *, size_t);
+int hist_is_last(history_t *, char *, size_t, size_t);
+
+/* histfind.c */
+trigram_t *hist_slot(histindex_t *, unsigned int, int);
+int hist_rehash(histindex_t *);
+int hist_index_add(histindex_t *, char *, size_t, unsigned int);
+int hist_index(history_t *);
+void hist_index_free(histindex_t *);
+
+/* histfind1.c */
+long hist_find(history_t *, char *, size_t, size_t);
+size_t hist_matches(history_t *, char *, size_t, size_t *, size_t);
+void hist_show(history_t *, size_t *, size_t);
+int hist_search(info_t *, char *, char *);
+
+/* histlog.c */
+int hist_lock(info_t *);
+int hist_append(history_t *);
+size_t hist_tail(char *, size_t, size_t);
+void hist_compact(info_t *);
+void hist_flush(info_t *, int);
 
 /* toem_history.c */
-char *getHistoryFile(info_t *info);
-int writeHistory(info_t *info);
-int readHistory(info_t *info);
-int buildHistoryList(info_t *info, char *buf, int linecount);
-int renumberHistory(info_t *info);
+char *get_history_file(info_t *info);
+int write_history(info_t *info);
+int read_history(info_t *info);
 
 /* toem_lists.c */
-list_t *addNode(list_t **, const char *, int);
-list_t *addNodeAtEnd(list_t **, const char *, int);
-size_t printListStrings(const list_t *);
-int deleteNodeAtIndex(list_t **, unsigned int);
-void freeList(list_t **);
+list_t *add_node(list_t **, const char *, int);
+list_t *add_node_end(list_t **, const char *, int);
+size_t print_list_str(const list_t *);
+int delete_node_at_index(list_t **, unsigned int);
+void free_list(list_t **);
 
 /* toem_lists1.c */
-size_t listLength(const list_t *);
-char **listToStrings(list_t *);
-size_t printList(const list_t *);
-list_t *nodeStartsWith(list_t *, char *, char);
-ssize_t getNodeIndex(list_t *, list_t *);
+size_t list_len(const list_t *);
+char **list_to_strings(list_t *);
+size_t print_list(const list_t *);
+list_t *node_starts_with(list_t *, char *, char);
+ssize_t get_node_index(list_t *, list_t *);
 
 /* toem_vars.c */
-int isCommandChain(info_t *, char *, size_t *);
-void checkCommandChain(info_t *, char *, size_t *, size_t, size_t);
-int replaceAlias(info_t *);
-int replaceVariables(info_t *);
-int replaceString(char **, char *);
+char *expand_word(info_t *, char *, int);
+int is_name(char *);
 
 #endif
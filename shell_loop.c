@@ -9,71 +9,109 @@
  */
 int mainShellLoop(info_t *info, char **av)
 {
-	ssize_t inputResult = 0;
+	node_t *tree;
+	arena_mark_t mark;
 	int builtinResult = 0;
 
-	while (inputResult != -1 && builtinResult != -2)
+	info->fname = av[0];
+	while (builtinResult != -2)
 	{
-		clearInfo(info);
-		if (isInteractive(info))
-			printPrompt("$ ");
-		flushErrorBuffer();
-		inputResult = getInput(info);
-		if (inputResult != -1)
+		clear_info(info);
+		mark = arena_mark(&(info->arena));
+		reap_jobs(info);
+		show_prompt(info, "$ ");
+		_eputchar(BUF_FLUSH);
+		if (parse_command(info, &tree) == -1)
 		{
-			setInfo(info, av);
-			builtinResult = findBuiltin(info);
-			if (builtinResult == -1)
-				findCommand(info);
+			if (interactive(info))
+				_putchar('\n');
+			break;
 		}
-		else if (isInteractive(info))
-			printCharacter('\n');
-		freeInfo(info, 0);
+		hist_flush(info, 0);
+		builtinResult = eval_node(info, tree);
+		free_info(info, 0);
+		arena_release(&(info->arena), mark);
+		if (info->skip == SKIP_ERROR && !interactive(info))
+			break;
+		if (info->skip >= SKIP_INTR)
+			info->skip = 0;
 	}
-	writeHistory(info);
-	freeInfo(info, 1);
-	if (!isInteractive(info) && info->status)
+	_eputchar(BUF_FLUSH);
+	write_history(info);
+	free_info(info, 1);
+	if (!interactive(info) && info->status)
 		exit(info->status);
 	if (builtinResult == -2)
 	{
-		if (info->errorNumber == -1)
+		if (info->err_num == -1)
 			exit(info->status);
-		exit(info->errorNumber);
+		exit(info->err_num);
 	}
 	return (builtinResult);
 }
 
+/**
+ * getBuiltin - looks up a builtin command by name
+ * @name: the command name
+ *
+ * Return: the matching builtin table entry, or NULL if none
+ */
+builtin_table *getBuiltin(char *name)
+{
+	int i;
+	static builtin_table builtintbl[] = {
+		{"exit", shell_exit},
+		{"env", _myenv},
+		{"help", shell_help},
+		{"history", display_history},
+		{"setenv", _mysetenv},
+		{"unsetenv", _myunsetenv},
+		{"cd", shell_change_dir},
+		{"alias", handle_alias},
+		{"hash", _myhash},
+		{"command", _mycommand},
+		{"jobs", _myjobs},
+		{"wait", _mywait},
+		{"fg", _myfg},
+		{"bg", _mybg},
+		{"echo", _myecho},
+		{"printf", _myprintf},
+		{"test", _mytest},
+		{"[", _mytest},
+		{"true", _mytrue},
+		{"false", _mytrue},
+		{"pwd", _mypwd},
+		{"kill", _mykill},
+		{"exec", _myexec},
+		{"break", _mybreak},
+		{"continue", _mybreak},
+		{NULL, NULL}
+	};
+
+	for (i = 0; builtintbl[i].type; i++)
+		if (_strcmp(name, builtintbl[i].type) == 0)
+			return (&builtintbl[i]);
+	return (NULL);
+}
+
 /**
  * findBuiltin - finds a builtin command
  * @info: the parameter and return info struct
  *
  * Return: -1 if builtin not found,
- *         0 if builtin executed successfully,
- *         1 if builtin found but not successful,
- *         2 if builtin signals exit()
+ *         -2 if builtin signals exit(),
+ *         otherwise the builtin's exit status, also stored in info->status
  */
 int findBuiltin(info_t *info)
 {
-	int i, builtinResult = -1;
-	builtin_table builtintbl[] = {
-		{"exit", myExit},
-		{"env", myEnv},
-		{"help", myHelp},
-		{"history", myHistory},
-		{"setenv", mySetenv},
-		{"unsetenv", myUnsetenv},
-		{"cd", myCd},
-		{"alias", myAlias},
-		{NULL, NULL}
-	};
+	builtin_table *builtin = getBuiltin(info->argv[0]);
+	int builtinResult;
 
-	for (i = 0; builtintbl[i].type; i++)
-		if (_strcmp(info->argv[0], builtintbl[i].type) == 0)
-		{
-			info->lineCount++;
-			builtinResult = builtintbl[i].func(info);
-			break;
-		}
+	if (!builtin)
+		return (-1);
+	builtinResult = run_builtin(info, builtin);
+	if (builtinResult >= 0)
+		info->status = builtinResult;
 	return (builtinResult);
 }
 
@@ -86,41 +124,40 @@ int findBuiltin(info_t *info)
 void findCommand(info_t *info)
 {
 	char *path = NULL;
-	int i, k;
 
 	info->path = info->argv[0];
-	if (info->lineCountFlag == 1)
+	if (!*info->argv[0])
 	{
-		info->lineCount++;
-		info->lineCountFlag = 0;
-	}
-	for (i = 0, k = 0; info->arg[i]; i++)
-		if (!isDelimiter(info->arg[i], " \t\n"))
-			k++;
-	if (!k)
+		info->status = open_redirs(info) ? 1 : info->subst_status;
 		return;
+	}
 
 	path = findPath(info, _getenv(info, "PATH="), info->argv[0]);
 	if (path)
 	{
 		info->path = path;
-		forkCommand(info);
+		if (!open_redirs(info))
+			forkCommand(info);
 	}
 	else
 	{
-		if ((isInteractive(info) || _getenv(info, "PATH=")
+		if ((interactive(info) || _getenv(info, "PATH=")
 					|| info->argv[0][0] == '/') && isCommand(info, info->argv[0]))
-			forkCommand(info);
-		else if (*(info->arg) != '\n')
+		{
+			if (!open_redirs(info))
+				forkCommand(info);
+		}
+		else
 		{
 			info->status = 127;
-			printError(info, "not found\n");
+			print_error(info, "not found\n");
 		}
 	}
 }
 
 /**
- * forkCommand - forks an exec thread to run cmd
+ * forkCommand - starts the resolved command and waits for it; under job
+ * control it gets a process group and the terminal, as a pipeline does
  * @info: the parameter and return info struct
  *
  * Return: void
@@ -129,32 +166,12 @@ void forkCommand(info_t *info)
 {
 	pid_t childPid;
 
-	childPid = fork();
+	childPid = spawn_stage(info, STDIN_FILENO, STDOUT_FILENO, 0);
 	if (childPid == -1)
-	{
-		/* TODO: PUT ERROR FUNCTION */
-		perror("Error:");
 		return;
-	}
-	if (childPid == 0)
-	{
-		if (execve(info->path, info->argv, getEnvironment(info)) == -1)
-		{
-			freeInfo(info, 1);
-			if (errno == EACCES)
-				exit(126);
-			exit(1);
-		}
-		/* TODO: PUT ERROR FUNCTION */
-	}
-	else
-	{
-		wait(&(info->status));
-		if (WIFEXITED(info->status))
-		{
-			info->status = WEXITSTATUS(info->status);
-			if (info->status == 126)
-				printError(info, "Permission denied\n");
-		}
-	}
+	set_foreground(info, childPid);
+	if (wait_foreground(info, &childPid, 1))
+		stop_job(info, &childPid, 1, join_words(info->argv, " "));
+	set_foreground(info, getpgrp());
+	collect_jobs(info);
 }
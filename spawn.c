@@ -0,0 +1,139 @@
+#include "shell.h"
+
+/**
+ * exec_status - maps a failed execve() errno to a shell exit status
+ * @err: the errno left by execve() or posix_spawn()
+ *
+ * Return: 126 if the file is not executable, 127 if it does not exist,
+ *         1 otherwise
+ */
+int exec_status(int err)
+{
+	if (err == EACCES)
+		return (126);
+	if (err == ENOENT)
+		return (127);
+	return (1);
+}
+
+/**
+ * decode_status - turns a waitpid() status into a shell exit status
+ * @wstatus: the status filled in by waitpid()
+ *
+ * Return: the exit code, or 128 + the signal number if it was killed
+ *         or stopped
+ */
+int decode_status(int wstatus)
+{
+	if (WIFEXITED(wstatus))
+		return (WEXITSTATUS(wstatus));
+	if (WIFSIGNALED(wstatus))
+		return (128 + WTERMSIG(wstatus));
+	if (WIFSTOPPED(wstatus))
+		return (128 + WSTOPSIG(wstatus));
+	return (wstatus);
+}
+
+/**
+ * spawn_command - starts info->path with posix_spawn(), which glibc
+ * implements with CLONE_VM|CLONE_VFORK so the heap is never copied
+ * @info: the parameter and return info struct
+ * @actions: file actions to run in the child, or NULL
+ * @attr: spawn attributes such as the process group, or NULL
+ *
+ * Return: pid of the child, or -1 with info->status set on failure
+ */
+pid_t spawn_command(info_t *info, posix_spawn_file_actions_t *actions,
+		posix_spawnattr_t *attr)
+{
+	pid_t pid;
+	int err;
+
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	err = posix_spawn(&pid, info->path, actions, attr, info->argv,
+			get_environ(info));
+	if (!err)
+		return (pid);
+	info->status = exec_status(err);
+	if (info->status == 126)
+		print_error(info, "Permission denied\n");
+	else if (info->status == 127)
+		print_error(info, "not found\n");
+	else
+		perror("Error:");
+	return (-1);
+}
+
+/**
+ * fork_command - starts info->path with a plain fork() and execve(), in
+ * place of spawn_stage() when USE_SPAWN is 0
+ * @info: the parameter and return info struct
+ * @in: fd to use as the command's stdin
+ * @out: fd to use as the command's stdout
+ * @pgid: process group to join, 0 to lead a new one, as for spawn_stage()
+ *
+ * Return: pid of the child, or -1 on fork failure
+ */
+pid_t fork_command(info_t *info, int in, int out, pid_t pgid)
+{
+	pid_t pid;
+	int status;
+	char **envp = get_environ(info);
+
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	pid = fork();
+	if (pid == -1)
+	{
+		perror("Error:");
+		return (-1);
+	}
+	if (pid && info->monitor)
+		setpgid(pid, pgid ? pgid : pid);
+	if (pid == 0)
+	{
+		if (info->monitor)
+			setpgid(0, pgid);
+		reset_signals(info);
+		if (in != STDIN_FILENO)
+			dup2(in, STDIN_FILENO);
+		if (out != STDOUT_FILENO)
+			dup2(out, STDOUT_FILENO);
+		apply_redirs(info, 0);
+		execve(info->path, info->argv, envp);
+		status = exec_status(errno);
+		if (status == 126)
+			print_error(info, "Permission denied\n");
+		_eputchar(BUF_FLUSH);
+		exit(status);
+	}
+	return (pid);
+}
+
+/**
+ * wait_command - waits for a child to exit or stop and records its status;
+ * under job control a child killed by Ctrl-C, which the shell does not see
+ * itself, stops the running loops as the shell's own SIGINT would
+ * @info: the parameter and return info struct
+ * @pid: the child to wait for
+ *
+ * Return: 1 if the child was stopped, 0 otherwise
+ */
+int wait_command(info_t *info, pid_t pid)
+{
+	int wstatus;
+
+	while (waitpid(pid, &wstatus, WUNTRACED) == -1)
+		if (errno != EINTR)
+			return (0);
+	info->status = decode_status(wstatus);
+	if (info->monitor && WIFSIGNALED(wstatus) &&
+			WTERMSIG(wstatus) == SIGINT)
+	{
+		sigint_seen = 1;
+		_putchar('\n');
+	}
+	return (WIFSTOPPED(wstatus));
+}
+
@@ -1,12 +1,12 @@
 #include "shell.h"
 
 /**
- * _stringLength - returns the length of a string
+ * _strlen - returns the length of a string
  * @str: the string whose length to check
  *
  * Return: integer length of the string
  */
-int _stringLength(char *str)
+int _strlen(char *str)
 {
 	int length = 0;
 
@@ -19,13 +19,13 @@ int _stringLength(char *str)
 }
 
 /**
- * _compareStrings - performs lexicographic comparison of two strings.
+ * _strcmp - performs lexicographic comparison of two strings.
  * @str1: the first string
  * @str2: the second string
  *
  * Return: negative if str1 < str2, positive if str1 > str2, zero if str1 == str2
  */
-int _compareStrings(char *str1, char *str2)
+int _strcmp(char *str1, char *str2)
 {
 	while (*str1 && *str2)
 	{
@@ -41,13 +41,13 @@ int _compareStrings(char *str1, char *str2)
 }
 
 /**
- * stringStartsWith - checks if "needle" starts with "haystack"
+ * starts_with - checks if "needle" starts with "haystack"
  * @haystack: string to search
  * @needle: the substring to find
  *
  * Return: address of the next character of "haystack" or NULL
  */
-char *stringStartsWith(const char *haystack, const char *needle)
+char *starts_with(const char *haystack, const char *needle)
 {
 	while (*needle)
 		if (*needle++ != *haystack++)
@@ -56,13 +56,13 @@ char *stringStartsWith(const char *haystack, const char *needle)
 }
 
 /**
- * _concatenateStrings - concatenates two strings
+ * _strcat - concatenates two strings
  * @destination: the destination buffer
  * @source: the source buffer
  *
  * Return: pointer to the destination buffer
  */
-char *_concatenateStrings(char *destination, char *source)
+char *_strcat(char *destination, char *source)
 {
 	char *result = destination;
 
@@ -1,13 +1,13 @@
 #include "shell.h"
 
 /**
- * _copyString - copies a string
+ * _strcpy - copies a string
  * @destination: the destination string
  * @source: the source string
  *
  * Return: pointer to the destination string
  */
-char *_copyString(char *destination, char *source)
+char *_strcpy(char *destination, char *source)
 {
 	int i = 0;
 
@@ -23,12 +23,12 @@ char *_copyString(char *destination, char *source)
 }
 
 /**
- * _duplicateString - duplicates a string
+ * _strdup - duplicates a string
  * @str: the string to duplicate
  *
  * Return: pointer to the duplicated string
  */
-char *_duplicateString(const char *str)
+char *_strdup(const char *str)
 {
 	int length = 0;
 	char *ret;
@@ -46,12 +46,12 @@ char *_duplicateString(const char *str)
 }
 
 /**
- * _printString - prints an input string
+ * _puts - prints an input string
  * @str: the string to be printed
  *
  * Return: Nothing
  */
-void _printString(char *str)
+void _puts(char *str)
 {
 	int i = 0;
 
@@ -59,19 +59,19 @@ void _printString(char *str)
 		return;
 	while (str[i] != '\0')
 	{
-		_outputCharacter(str[i]);
+		_putchar(str[i]);
 		i++;
 	}
 }
 
 /**
- * _outputCharacter - writes the character c to stdout
+ * _putchar - writes the character c to stdout
  * @c: The character to print
  *
  * Return: On success 1.
  * On error, -1 is returned, and errno is set appropriately.
  */
-int _outputCharacter(char c)
+int _putchar(char c)
 {
 	static int i;
 	static char buf[WRITE_BUF_SIZE];
@@ -0,0 +1,147 @@
+#include "shell.h"
+
+/**
+ * skip_subst - finds the end of a command substitution, the ')' of a
+ * $( form, skipping quoted text and nested parentheses, or the closing
+ * backquote of a ` form
+ * @s: the '$' or '`'
+ *
+ * Return: a pointer to the closing character, or NULL if there is none
+ */
+char *skip_subst(char *s)
+{
+	char quote = 0;
+	int depth = 1;
+
+	if (*s == '`')
+	{
+		for (s++; *s && *s != '`'; s++)
+			if (*s == '\\' && s[1])
+				s++;
+		return (*s ? s : NULL);
+	}
+	if (*s != '$' || s[1] != '(')
+		return (NULL);
+	for (s += 2; *s; s++)
+	{
+		if (quote == '\'')
+			quote = *s == '\'' ? 0 : quote;
+		else if (*s == '\\' && s[1])
+			s++;
+		else if (*s == '"' || (*s == '\'' && !quote))
+			quote = quote ? 0 : *s;
+		else if (!quote && *s == '(')
+			depth++;
+		else if (!quote && *s == ')' && !--depth)
+			return (s);
+	}
+	return (NULL);
+}
+
+/**
+ * unbacktick - removes the backslashes of \$, \` and \\ inside a `
+ * command substitution, which quote them only from the outer command
+ * @s: the command text, changed in place
+ *
+ * Return: void
+ */
+void unbacktick(char *s)
+{
+	char *w = s;
+
+	for (; *s; s++)
+	{
+		if (*s == '\\' && s[1] && _strchr("$`\\", s[1]))
+			s++;
+		*w++ = *s;
+	}
+	*w = '\0';
+}
+
+/**
+ * lex_source - reads the next line of a command substitution being run
+ * into the lexer, in place of reading the input
+ * @lx: the lexer
+ *
+ * Return: 0 on success, 1 at the end of the text
+ */
+int lex_source(lexer_t *lx)
+{
+	char *s = lx->info->source, *nl;
+
+	if (!*s)
+		return (lx->eof = 1, 1);
+	nl = _strchr(s, '\n');
+	if (nl)
+		*nl = '\0';
+	lx->info->source = nl ? nl + 1 : s + _strlen(s);
+	lx->line = s;
+	lx->pos = 0;
+	lx->lines++;
+	return (0);
+}
+
+/**
+ * capture - reads everything from a descriptor into a buffer that
+ * doubles as it fills, then closes the descriptor
+ * @fd: the descriptor
+ * @len: receives the number of bytes read
+ *
+ * Return: the malloc'ed buffer, or NULL on malloc failure
+ */
+char *capture(int fd, size_t *len)
+{
+	size_t size = 4096;
+	char *buf = malloc(size), *grown;
+	ssize_t r;
+
+	*len = 0;
+	while (buf)
+	{
+		if (*len == size)
+		{
+			grown = realloc(buf, size * 2);
+			if (!grown)
+			{
+				free(buf);
+				*len = 0;
+			}
+			buf = grown;
+			size *= 2;
+			continue;
+		}
+		r = read(fd, buf + *len, size - *len);
+		if (r == -1 && errno == EINTR)
+			continue;
+		if (r <= 0)
+			break;
+		*len += r;
+	}
+	close(fd);
+	return (buf);
+}
+
+/**
+ * subst_inline - checks if a command substitution can run in the shell
+ * itself: a simple command, with no assignments, of a builtin that
+ * changes nothing in the shell, and with no word that could assign a
+ * variable as it is expanded
+ * @info: the parameter struct
+ * @tree: the command
+ *
+ * Return: 1 if it can, 0 if it needs a child process
+ */
+int subst_inline(info_t *info, node_t *tree)
+{
+	static char * const pure[] = {"echo", "printf", "pwd", "test", "[",
+		"true", "false", NULL};
+	int i;
+
+	if (tree->type != NODE_CMD || !tree->nwords ||
+			alias_find(info, tree->words[0]) || subst_assigns(tree))
+		return (0);
+	for (i = 0; pure[i]; i++)
+		if (!_strcmp(tree->words[0], pure[i]))
+			return (1);
+	return (0);
+}
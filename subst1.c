@@ -0,0 +1,182 @@
+#include "shell.h"
+
+/**
+ * subst_assigns - checks if expanding the words or redirections of a
+ * simple command could assign a variable, as ${name=word}, ${name:=word},
+ * $((name = expr)) and $((name++)) do; any '=', "++" or "--" after the
+ * start of such an expansion counts, so a few words that assign nothing
+ * are taken for ones that do
+ * @tree: the command
+ *
+ * Return: 1 if it could, 0 if it cannot
+ */
+int subst_assigns(node_t *tree)
+{
+	redir_t *r = tree->redirs;
+	char *w;
+	int i, expanding;
+
+	for (i = 0; ; i++)
+	{
+		if (i < tree->nwords)
+			w = tree->words[i];
+		else if (r)
+			w = r->target, r = r->next;
+		else
+			return (0);
+		for (expanding = 0; w && *w; w++)
+		{
+			if (*w == '$' && (w[1] == '{' || starts_with(w, "$((")))
+				expanding = 1;
+			else if (expanding && (*w == '=' ||
+					(_strchr("+-", *w) && w[1] == *w)))
+				return (1);
+		}
+	}
+}
+
+/**
+ * subst_builtin - runs a builtin command substitution in the shell, its
+ * output going to an in-memory file instead of a pipe, which it could
+ * fill up with no one reading it yet
+ * @info: the parameter struct
+ * @tree: the command
+ *
+ * Return: the file, at offset 0, or -1 on error
+ */
+int subst_builtin(info_t *info, node_t *tree)
+{
+	int fd = memfd_create("command-substitution", MFD_CLOEXEC), saved;
+
+	if (fd == -1)
+		return (-1);
+	saved = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, FD_SHELL_MIN);
+	dup2(fd, STDOUT_FILENO);
+	eval_command(info, tree);
+	_putchar(BUF_FLUSH);
+	if (saved == -1)
+		close(STDOUT_FILENO);
+	else
+	{
+		dup2(saved, STDOUT_FILENO);
+		close(saved);
+	}
+	lseek(fd, 0, SEEK_SET);
+	return (fd);
+}
+
+/**
+ * subst_start - starts a command substitution, keeping the state of the
+ * command being expanded, whose argv, assignments and redirections may
+ * be half built; a simple command whose expansion could assign a
+ * variable is expanded in the child, the only place it may change; an
+ * error that would end a script only fails the substitution, a subshell
+ * @info: the parameter struct
+ * @tree: the command
+ * @fd: receives the descriptor to read its output from, or -1
+ *
+ * Return: the pid of the child to wait for, or 0 if there is none
+ */
+pid_t subst_start(info_t *info, node_t *tree, int *fd)
+{
+	char **argv = info->argv, **saved_vars = info->saved_vars;
+	redir_t *redirs = info->redirs;
+	int argc = info->argc, nsaved = info->nsaved, fds[2];
+	pid_t pid = 0, pgid = getpgrp();
+
+	_putchar(BUF_FLUSH);
+	_eputchar(BUF_FLUSH);
+	info->redirs = NULL;
+	info->nsaved = 0;
+	*fd = -1;
+	if (subst_inline(info, tree))
+		*fd = subst_builtin(info, tree);
+	else if (!pipe2(fds, O_CLOEXEC))
+	{
+		if (tree->type == NODE_CMD && subst_assigns(tree))
+			pid = fork_stage(info, tree, STDIN_FILENO, fds[1],
+					pgid);
+		else
+			pid = start_stage(info, tree, STDIN_FILENO, fds[1],
+					pgid);
+		pid = pid > 0 ? pid : 0;
+		close(fds[1]);
+		*fd = fds[0];
+	}
+	info->argv = argv;
+	info->argc = argc;
+	info->redirs = redirs;
+	info->saved_vars = saved_vars;
+	info->nsaved = nsaved;
+	if (info->skip == SKIP_ERROR)
+	{
+		info->skip = 0;
+		info->status = 2;
+	}
+	return (pid);
+}
+
+/**
+ * run_subst - runs the command of a command substitution and collects
+ * its output; a builtin that changes nothing runs without a fork
+ * @info: the parameter struct
+ * @text: the command text
+ * @n: its length
+ * @backquoted: on for the ` form
+ * @len: receives the length of the output
+ *
+ * Return: the output, malloc'ed, or NULL if there is none
+ */
+char *run_subst(info_t *info, char *text, size_t n, int backquoted,
+		size_t *len)
+{
+	arena_mark_t mark = arena_mark(&(info->arena));
+	char *source = info->source, *out = NULL;
+	node_t *tree = NULL;
+	pid_t pid = 0;
+	int fd = -1, wstatus;
+
+	*len = 0;
+	info->source = arena_copy(&(info->arena), text, n);
+	if (info->source && backquoted)
+		unbacktick(info->source);
+	if (info->source && parse_command(info, &tree) != -1 && tree)
+		pid = subst_start(info, tree, &fd);
+	info->source = source;
+	if (fd != -1)
+		out = capture(fd, len);
+	while (pid > 0 && waitpid(pid, &wstatus, 0) == -1)
+		if (errno != EINTR)
+			pid = 0;
+	if (pid > 0)
+		info->status = decode_status(wstatus);
+	info->subst_status = info->status;
+	arena_release(&(info->arena), mark);
+	return (out);
+}
+
+/**
+ * exp_subst - expands a $(command) or `command` substitution into its
+ * output without the trailing newlines, split like any other expansion
+ * @e: the expander
+ * @s: the '$' or '`'
+ * @dq: on inside double quotes
+ *
+ * Return: a pointer past the substitution, or NULL on error
+ */
+char *exp_subst(expand_t *e, char *s, int dq)
+{
+	char *end = skip_subst(s), *text, *out;
+	size_t len;
+	int ret;
+
+	if (!end)
+		return (exp_put(e, s, 1, dq) ? NULL : s + 1);
+	text = s + (*s == '$' ? 2 : 1);
+	out = run_subst(e->info, text, end - text, *s == '`', &len);
+	while (len && out[len - 1] == '\n')
+		len--;
+	ret = exp_value(e, out ? out : "", len, dq);
+	free(out);
+	return (ret ? NULL : end + 1);
+}
@@ -0,0 +1,173 @@
+#include "shell.h"
+
+/**
+ * test_unary - evaluates a unary test primary such as -f file
+ * @op: the operator
+ * @arg: its operand
+ *
+ * Return: 0 if true, 1 if false
+ */
+int test_unary(char *op, char *arg)
+{
+	struct stat st;
+	int found = op[1] == 'L' || op[1] == 'h' ? !lstat(arg, &st)
+		: !stat(arg, &st);
+
+	switch (op[1])
+	{
+	case 'n':
+		return (!*arg);
+	case 'z':
+		return (!!*arg);
+	case 'e':
+		return (!found);
+	case 'f':
+		return (!(found && S_ISREG(st.st_mode)));
+	case 'd':
+		return (!(found && S_ISDIR(st.st_mode)));
+	case 'L':
+	case 'h':
+		return (!(found && S_ISLNK(st.st_mode)));
+	case 'b':
+		return (!(found && S_ISBLK(st.st_mode)));
+	case 'c':
+		return (!(found && S_ISCHR(st.st_mode)));
+	case 'p':
+		return (!(found && S_ISFIFO(st.st_mode)));
+	case 'S':
+		return (!(found && S_ISSOCK(st.st_mode)));
+	case 's':
+		return (!(found && st.st_size > 0));
+	case 'r':
+		return (access(arg, R_OK) != 0);
+	case 'w':
+		return (access(arg, W_OK) != 0);
+	case 'x':
+		return (access(arg, X_OK) != 0);
+	}
+	return (!isatty((int)strtol(arg, NULL, 10)));
+}
+
+/**
+ * test_binary - evaluates a binary test primary such as a -lt b
+ * @info: the parameter struct, for error messages
+ * @a: the left operand
+ * @op: the operator
+ * @b: the right operand
+ *
+ * Return: 0 if true, 1 if false, 2 if an operand is not an integer
+ */
+int test_binary(info_t *info, char *a, char *op, char *b)
+{
+	char *end1, *end2;
+	long x, y;
+
+	if (!_strcmp(op, "=") || !_strcmp(op, "=="))
+		return (_strcmp(a, b) != 0);
+	if (!_strcmp(op, "!="))
+		return (_strcmp(a, b) == 0);
+	x = strtol(a, &end1, 10);
+	y = strtol(b, &end2, 10);
+	if (*end1 || *end2 || !*a || !*b)
+	{
+		print_error(info, *end1 || !*a ? a : b);
+		_eputs(": integer expression expected\n");
+		return (2);
+	}
+	if (op[1] == 'e')
+		return (!(x == y));
+	if (op[1] == 'n')
+		return (!(x != y));
+	if (op[1] == 'l')
+		return (!(op[2] == 't' ? x < y : x <= y));
+	return (!(op[2] == 't' ? x > y : x >= y));
+}
+
+/**
+ * test_primary - parses and evaluates `! expr`, `( expr )`, a unary or
+ * binary primary, or a lone string
+ * @info: the parameter struct, its argv holds the expression
+ * @i: address of the index of the next argument
+ * @n: the number of arguments that belong to the expression
+ *
+ * Return: 0 if true, 1 if false, 2 on error
+ */
+int test_primary(info_t *info, int *i, int n)
+{
+	char **av = info->argv;
+	int r;
+
+	if (*i >= n)
+		return (print_error(info, "argument expected\n"), 2);
+	if (!_strcmp(av[*i], "!") && *i + 1 < n)
+	{
+		(*i)++;
+		r = test_primary(info, i, n);
+		return (r == 2 ? 2 : !r);
+	}
+	if (*i + 2 < n && is_test_binary(av[*i + 1]))
+	{
+		*i += 3;
+		return (test_binary(info, av[*i - 3], av[*i - 2], av[*i - 1]));
+	}
+	if (!_strcmp(av[*i], "(") && *i + 1 < n)
+	{
+		(*i)++;
+		r = test_or(info, i, n);
+		if (r != 2 && (*i >= n || _strcmp(av[*i], ")")))
+			return (print_error(info, "')' expected\n"), 2);
+		(*i)++;
+		return (r);
+	}
+	if (av[*i][0] == '-' && av[*i][1] && !av[*i][2] && *i + 1 < n &&
+			_strchr("nzefdLhbcpSsrwxt", av[*i][1]))
+	{
+		*i += 2;
+		return (test_unary(av[*i - 2], av[*i - 1]));
+	}
+	return (!av[(*i)++][0]);
+}
+
+/**
+ * test_and - evaluates primaries joined by -a
+ * @info: the parameter struct, its argv holds the expression
+ * @i: address of the index of the next argument
+ * @n: the number of arguments that belong to the expression
+ *
+ * Return: 0 if true, 1 if false, 2 on error
+ */
+int test_and(info_t *info, int *i, int n)
+{
+	int r, r2;
+
+	r = test_primary(info, i, n);
+	while (r != 2 && *i < n && !_strcmp(info->argv[*i], "-a"))
+	{
+		(*i)++;
+		r2 = test_primary(info, i, n);
+		r = r2 == 2 ? 2 : r || r2;
+	}
+	return (r);
+}
+
+/**
+ * test_or - evaluates -a expressions joined by -o
+ * @info: the parameter struct, its argv holds the expression
+ * @i: address of the index of the next argument
+ * @n: the number of arguments that belong to the expression
+ *
+ * Return: 0 if true, 1 if false, 2 on error
+ */
+int test_or(info_t *info, int *i, int n)
+{
+	int r, r2;
+
+	r = test_and(info, i, n);
+	while (r != 2 && *i < n && !_strcmp(info->argv[*i], "-o"))
+	{
+		(*i)++;
+		r2 = test_and(info, i, n);
+		r = r2 == 2 ? 2 : r && r2;
+	}
+	return (r);
+}
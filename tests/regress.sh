@@ -0,0 +1,78 @@
+#!/bin/sh
+# regress.sh - feeds small scripts to the shell on stdin and compares what
+# it prints, stdout and stderr together, with the expected text
+# usage: tests/regress.sh [path to hsh], run from the top of the tree
+
+HSH=${1:-./hsh}
+case $HSH in /*) ;; *) HSH=$PWD/$HSH ;; esac
+TMP=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP"' EXIT
+fail=0
+
+# check NAME INPUT EXPECTED, with the shell's name in messages as "hsh"
+check()
+{
+	out=$(cd "$TMP" && printf '%s\n' "$2" | timeout 5 "$HSH" 2>&1 |
+		sed "s|^$HSH:|hsh:|")
+	if [ "$out" != "$3" ]
+	then
+		printf 'FAIL %s\n--- expected\n%s\n--- got\n%s\n' "$1" "$3" "$out"
+		fail=1
+	fi
+}
+
+printf '#!/bin/sh\nexit 126\n' > "$TMP/e126"
+chmod +x "$TMP/e126"
+
+check pipeline-126 './e126 | cat
+echo after $?
+./e126 | ./e126
+echo $?' 'after 0
+126'
+
+check alias-open-quote 'alias x="echo '"'"'a b"
+x
+alias y='"'"'echo "c  d'"'"'
+y' 'a b
+c  d'
+
+check subst-assign 'x=1
+echo $(echo ${y:=set} $((x+=1)))
+echo y=$y x=$x' 'set 2
+y= x=1'
+
+check printf-errors 'printf "%d\n" 99999999999999999999
+echo $?
+printf "%d\n" 1x
+printf "%q\n"
+echo $?' 'hsh: 1: printf: 99999999999999999999: Numerical result out of range
+9223372036854775807
+1
+hsh: 3: printf: 1x: invalid number
+1
+hsh: 4: printf: %q: invalid directive
+1'
+
+check fatal-errors 'x=$(echo $((1/0))); echo subst $?
+echo $((1/0)) | cat; echo pipe $?
+for i in 1 2; do break 0; echo in; done
+echo not reached' 'hsh: 1: arithmetic expression: division by zero: "1/0"
+subst 2
+hsh: 2: arithmetic expression: division by zero: "1/0"
+pipe 0
+hsh: 3: break: Illegal number: 0'
+
+check default-split 'for w in ${x:-a  b} "${x:-c d}" ${x:-"e f"} \
+	${y-i ${z:-j k}}l
+do echo "[$w]"; done
+IFS=:; for w in ${HOME:+m:n o}; do echo "<$w>"; done' '[a]
+[b]
+[c d]
+[e f]
+[i]
+[j]
+[kl]
+<m>
+<n o>'
+
+exit $fail
@@ -1,158 +1,43 @@
 #include "shell.h"
 
 /**
- * Check if the current character in the buffer is a chain delimiter.
+ * Expand a word on its own, as for a redirection target or a case
+ * subject, into a single field: no field splitting.
  *
  * @param info - the parameter struct
- * @param buf - the character buffer
- * @param p - address of the current position in buf
+ * @param word - the word as written
+ * @param pattern - on for a case pattern, so quoted *, ? and [ match
+ *                  themselves, see exp_put()
  *
- * @return 1 if it's a chain delimiter, 0 otherwise
+ * @return the expansion, in the arena, NULL on error
  */
-int is_chain(info_t *info, char *buf, size_t *p)
+char *expand_word(info_t *info, char *word, int pattern)
 {
-    size_t j = *p;
-
-    if (buf[j] == '|' && buf[j + 1] == '|')
-    {
-        buf[j] = 0;
-        j++;
-        info->cmd_buf_type = CMD_OR;
-    }
-    else if (buf[j] == '&' && buf[j + 1] == '&')
-    {
-        buf[j] = 0;
-        j++;
-        info->cmd_buf_type = CMD_AND;
-    }
-    else if (buf[j] == ';') /* Found the end of this command */
-    {
-        buf[j] = 0; /* Replace semicolon with null */
-        info->cmd_buf_type = CMD_CHAIN;
-    }
-    else
-        return (0);
-    *p = j;
-    return (1);
-}
-
-/**
- * Check whether we should continue chaining based on the last status.
- *
- * @param info - the parameter struct
- * @param buf - the character buffer
- * @param p - address of the current position in buf
- * @param i - starting position in buf
- * @param len - length of buf
- *
- * @return Void
- */
-void check_chain(info_t *info, char *buf, size_t *p, size_t i, size_t len)
-{
-    size_t j = *p;
-
-    if (info->cmd_buf_type == CMD_AND)
-    {
-        if (info->status)
-        {
-            buf[i] = 0;
-            j = len;
-        }
-    }
-    if (info->cmd_buf_type == CMD_OR)
-    {
-        if (!info->status)
-        {
-            buf[i] = 0;
-            j = len;
-        }
-    }
-
-    *p = j;
+    expand_t e = {NULL, NULL, 0, 0, 0, 0, 0, 0};
+
+    e.info = info;
+    e.flags = pattern ? EXP_PATTERN : 0;
+    if (exp_text(&e, word, NULL, 0) || exp_grow(&e, 1))
+        return (NULL);
+    e.buf[e.len] = '\0';
+    return (e.buf);
 }
 
 /**
- * Replace aliases in the tokenized string.
+ * Check whether a string is a valid variable name.
  *
- * @param info - the parameter struct
+ * @param name - the string
  *
- * @return 1 if replaced, 0 otherwise
+ * @return 1 if it is, 0 otherwise
  */
-int replace_alias(info_t *info)
+int is_name(char *name)
 {
     int i;
-    list_t *node;
-    char *p;
 
-    for (i = 0; i < 10; i++)
-    {
-        node = node_starts_with(info->alias, info->argv[0], '=');
-        if (!node)
-            return (0);
-        free(info->argv[0]);
-        p = _strchr(node->str, '=');
-        if (!p)
-            return (0);
-        p = _strdup(p + 1);
-        if (!p)
+    if (!name || !*name || char_class[(unsigned char)*name] & CC_DIGIT)
+        return (0);
+    for (i = 0; name[i]; i++)
+        if (!(char_class[(unsigned char)name[i]] & CC_NAME))
             return (0);
-        info->argv[0] = p;
-    }
-    return (1);
-}
-
-/**
- * Replace variables in the tokenized string.
- *
- * @param info - the parameter struct
- *
- * @return 1 if replaced, 0 otherwise
- */
-int replace_vars(info_t *info)
-{
-    int i = 0;
-    list_t *node;
-
-    for (i = 0; info->argv[i]; i++)
-    {
-        if (info->argv[i][0] != '$' || !info->argv[i][1])
-            continue;
-
-        if (!_strcmp(info->argv[i], "$?"))
-        {
-            replace_string(&(info->argv[i]),
-                    _strdup(convert_number(info->status, 10, 0)));
-            continue;
-        }
-        if (!_strcmp(info->argv[i], "$$"))
-        {
-            replace_string(&(info->argv[i]),
-                    _strdup(convert_number(getpid(), 10, 0)));
-            continue;
-        }
-        node = node_starts_with(info->env, &info->argv[i][1], '=');
-        if (node)
-        {
-            replace_string(&(info->argv[i]),
-                    _strdup(_strchr(node->str, '=') + 1));
-            continue;
-        }
-        replace_string(&info->argv[i], _strdup(""));
-    }
-    return (0);
-}
-
-/**
- * Replace a string.
- *
- * @param old - address of the old string
- * @param new - new string
- *
- * @return 1 if replaced, 0 otherwise
- */
-int replace_string(char **old, char *new)
-{
-    free(*old);
-    *old = new;
     return (1);
 }